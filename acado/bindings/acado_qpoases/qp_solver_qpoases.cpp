@@ -44,12 +44,18 @@ BEGIN_NAMESPACE_ACADO
 QPsolver_qpOASES::QPsolver_qpOASES( ) : DenseQPsolver( )
 {
 	qp = 0;
+
+	performHotstart = 0;
+	cachedOptionsRevision = (uint)-1;
 }
 
 
 QPsolver_qpOASES::QPsolver_qpOASES( UserInteraction* _userInteraction ) : DenseQPsolver( _userInteraction )
 {
 	qp = 0;
+
+	performHotstart = 0;
+	cachedOptionsRevision = (uint)-1;
 }
 
 
@@ -59,6 +65,9 @@ QPsolver_qpOASES::QPsolver_qpOASES( const QPsolver_qpOASES& rhs ) : DenseQPsolve
 		qp = new qpOASES::SQProblem( *(rhs.qp) );
 	else
 		qp = 0;
+
+	performHotstart = 0;
+	cachedOptionsRevision = (uint)-1;
 }
 
 
@@ -84,6 +93,8 @@ QPsolver_qpOASES& QPsolver_qpOASES::operator=( const QPsolver_qpOASES& rhs )
 		else
 			qp = 0;
 
+		performHotstart = 0;
+		cachedOptionsRevision = (uint)-1;
     }
 
     return *this;
@@ -134,8 +145,11 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 	}
 	else
 	{
-		int performHotstart = 0;
-		get( HOTSTART_QP,performHotstart );
+		if ( cachedOptionsRevision != getOptionsRevision( ) )
+		{
+			get( HOTSTART_QP,performHotstart );
+			cachedOptionsRevision = getOptionsRevision( );
+		}
 
 		if ( (bool)performHotstart == true )
 		{
@@ -202,6 +202,11 @@ class QPsolver_qpOASES : public DenseQPsolver
     //
     protected:
 		qpOASES::SQProblem* qp;
+
+		/** Cached value of the HOTSTART_QP option. */
+		int performHotstart;
+		/** Options revision at which the cached option values have been read. */
+		uint cachedOptionsRevision;
 };
 
 
@@ -0,0 +1,330 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file src/clock/profiler.cpp
+*/
+
+
+#include <acado/clock/profiler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Node of the profiler tree, i.e. one call path of a section. */
+struct ProfilerNode
+{
+	const char* name;		/**< Name of the section. */
+	int parent;				/**< Index of parent node. */
+	int firstChild;			/**< Index of first child node, -1 if none. */
+	int nextSibling;		/**< Index of next sibling node, -1 if none. */
+	uint numCalls;			/**< Number of completed calls. */
+	uint64_t startNs;		/**< Time instant of the currently open call. */
+	uint64_t totalNs;		/**< Accumulated time of all calls. */
+	uint64_t minNs;			/**< Shortest call. */
+	uint64_t maxNs;			/**< Longest call. */
+};
+
+
+/** Profiler tree of one thread. Node 0 is an unnamed root node. */
+struct ProfilerTree
+{
+	ProfilerTree( )
+	{
+		clear( );
+	}
+
+	void clear( )
+	{
+		ProfilerNode root = { 0, -1, -1, -1, 0, 0, 0, 0, 0 };
+
+		nodes.clear( );
+		nodes.push_back( root );
+		current = 0;
+	}
+
+	std::vector< ProfilerNode > nodes;
+	int current;
+};
+
+
+#ifdef ACADO_HAS_CXX11
+static thread_local ProfilerTree profilerTree;
+#else
+static ProfilerTree profilerTree;
+#endif
+
+
+static uint64_t getChildrenTime(	const ProfilerTree& tree,
+									int idx
+									)
+{
+	uint64_t childrenNs = 0;
+
+	for( int child = tree.nodes[ idx ].firstChild; child >= 0; child = tree.nodes[ child ].nextSibling )
+		childrenNs += tree.nodes[ child ].totalNs;
+
+	return childrenNs;
+}
+
+
+static void printNode(	std::ostream& stream,
+						const ProfilerTree& tree,
+						int idx,
+						uint depth,
+						double parentTime
+						)
+{
+	const ProfilerNode& node = tree.nodes[ idx ];
+
+	double totalTime = 1.0e-9 * node.totalNs;
+	double avgTime   = node.numCalls > 0 ? totalTime / node.numCalls : 0.0;
+	double minTime   = node.numCalls > 0 ? 1.0e-9 * node.minNs : 0.0;
+	double maxTime   = 1.0e-9 * node.maxNs;
+
+	std::string label = std::string( 2 * depth,' ' ) + node.name;
+
+	stream	<< std::left << std::setw( 40 ) << label << std::right
+			<< std::setw( 10 ) << node.numCalls
+			<< std::scientific << std::setprecision( 3 )
+			<< std::setw( 12 ) << totalTime
+			<< std::setw( 12 ) << avgTime
+			<< std::setw( 12 ) << minTime
+			<< std::setw( 12 ) << maxTime
+			<< std::fixed << std::setprecision( 1 )
+			<< std::setw( 12 ) << ( parentTime > 0.0 ? 100.0 * totalTime / parentTime : 100.0 )
+			<< std::endl;
+
+	for( int child = node.firstChild; child >= 0; child = tree.nodes[ child ].nextSibling )
+		printNode( stream, tree, child, depth + 1, totalTime );
+}
+
+
+static void printFoldedNode(	std::ostream& stream,
+								const ProfilerTree& tree,
+								int idx,
+								const std::string& path
+								)
+{
+	const ProfilerNode& node = tree.nodes[ idx ];
+
+	// semicolons separate stack frames in the folded format
+	std::string name( node.name );
+	std::replace( name.begin(), name.end(), ';', ':' );
+
+	std::string stack = path.empty() ? name : path + ";" + name;
+
+	uint64_t childrenNs = getChildrenTime( tree,idx );
+	if ( node.totalNs > childrenNs )
+		stream << stack << " " << node.totalNs - childrenNs << std::endl;
+
+	for( int child = node.firstChild; child >= 0; child = tree.nodes[ child ].nextSibling )
+		printFoldedNode( stream, tree, child, stack );
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+#ifdef ACADO_HAS_CXX11
+std::atomic< bool > Profiler::enabled( false );
+#else
+bool Profiler::enabled = false;
+#endif
+
+
+returnValue Profiler::reset( )
+{
+	profilerTree.clear( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void Profiler::enterSection(	const char* name
+								)
+{
+	ProfilerTree& tree = profilerTree;
+
+	int child = tree.nodes[ tree.current ].firstChild;
+	int last  = -1;
+
+	while( child >= 0 )
+	{
+		const char* childName = tree.nodes[ child ].name;
+		if ( ( childName == name ) || ( strcmp( childName,name ) == 0 ) )
+			break;
+
+		last  = child;
+		child = tree.nodes[ child ].nextSibling;
+	}
+
+	if ( child < 0 )
+	{
+		ProfilerNode node = { name, tree.current, -1, -1, 0, 0, 0, (uint64_t)-1, 0 };
+
+		child = (int)tree.nodes.size( );
+		tree.nodes.push_back( node );
+
+		if ( last < 0 )
+			tree.nodes[ tree.current ].firstChild = child;
+		else
+			tree.nodes[ last ].nextSibling = child;
+	}
+
+	tree.current = child;
+	tree.nodes[ child ].startNs = acadoGetTimeNs( );
+}
+
+
+void Profiler::leaveSection( )
+{
+	uint64_t stopNs = acadoGetTimeNs( );
+
+	ProfilerTree& tree = profilerTree;
+
+	// sections opened before the last reset are silently ignored
+	if ( tree.current <= 0 )
+		return;
+
+	ProfilerNode& node = tree.nodes[ tree.current ];
+	uint64_t elapsedNs = stopNs - node.startNs;
+
+	++node.numCalls;
+	node.totalNs += elapsedNs;
+
+	if ( elapsedNs < node.minNs )
+		node.minNs = elapsedNs;
+	if ( elapsedNs > node.maxNs )
+		node.maxNs = elapsedNs;
+
+	tree.current = node.parent;
+}
+
+
+returnValue Profiler::getSectionTime(	const std::string& name,
+										double& totalTime,
+										uint& numCalls
+										)
+{
+	const ProfilerTree& tree = profilerTree;
+	uint64_t totalNs = 0;
+
+	numCalls = 0;
+
+	for( uint i = 1; i < tree.nodes.size( ); ++i )
+	{
+		if ( name != tree.nodes[ i ].name )
+			continue;
+
+		// do not count recursive calls twice
+		int ancestor = tree.nodes[ i ].parent;
+		while( ( ancestor > 0 ) && ( name != tree.nodes[ ancestor ].name ) )
+			ancestor = tree.nodes[ ancestor ].parent;
+
+		numCalls += tree.nodes[ i ].numCalls;
+		if ( ancestor <= 0 )
+			totalNs += tree.nodes[ i ].totalNs;
+	}
+
+	totalTime = 1.0e-9 * totalNs;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Profiler::print(	std::ostream& stream,
+								const std::string& name
+								)
+{
+	const ProfilerTree& tree = profilerTree;
+
+	std::ios_base::fmtflags flags = stream.flags( );
+	std::streamsize precision = stream.precision( );
+
+	stream	<< std::left << std::setw( 40 ) << "SECTION" << std::right
+			<< std::setw( 10 ) << "CALLS"
+			<< std::setw( 12 ) << "TOTAL [sec]"
+			<< std::setw( 12 ) << "AVG [sec]"
+			<< std::setw( 12 ) << "MIN [sec]"
+			<< std::setw( 12 ) << "MAX [sec]"
+			<< std::setw( 12 ) << "PARENT [%]"
+			<< std::endl;
+
+	if ( name.empty() == true )
+	{
+		for( int child = tree.nodes[ 0 ].firstChild; child >= 0; child = tree.nodes[ child ].nextSibling )
+			printNode( stream, tree, child, 0, 0.0 );
+	}
+	else
+	{
+		for( uint i = 1; i < tree.nodes.size( ); ++i )
+		{
+			if ( name != tree.nodes[ i ].name )
+				continue;
+
+			// print outermost occurrences only, nested ones are part of their subtree
+			int ancestor = tree.nodes[ i ].parent;
+			while( ( ancestor > 0 ) && ( name != tree.nodes[ ancestor ].name ) )
+				ancestor = tree.nodes[ ancestor ].parent;
+
+			if ( ancestor <= 0 )
+				printNode( stream, tree, i, 0, 0.0 );
+		}
+	}
+
+	stream.flags( flags );
+	stream.precision( precision );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Profiler::printFoldedStacks(	std::ostream& stream
+											)
+{
+	const ProfilerTree& tree = profilerTree;
+
+	for( int child = tree.nodes[ 0 ].firstChild; child >= 0; child = tree.nodes[ child ].nextSibling )
+		printFoldedNode( stream, tree, child, std::string() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
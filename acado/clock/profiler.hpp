@@ -0,0 +1,217 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/clock/profiler.hpp
+*/
+
+
+#ifndef ACADO_TOOLKIT_PROFILER_HPP
+#define ACADO_TOOLKIT_PROFILER_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#endif
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Hierarchical run-time profiler based on a monotonic clock.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class Profiler records the time spent in nested, named sections of
+ *	the code (e.g. SQP iteration -> integration -> function evaluation ->
+ *	automatic differentiation). Each distinct call path forms a node of a
+ *	tree which accumulates the number of calls as well as the total, minimum
+ *	and maximum time spent in it.
+ *
+ *	Sections are usually opened by means of the ACADO_PROFILE macro which
+ *	creates a scoped ProfilerSection object. As long as the profiler is
+ *	disabled (default), this costs a single flag check per section. Defining
+ *	ACADO_DISABLE_PROFILER at compile time removes all sections completely.
+ *
+ *	The recorded tree can be printed as a table or exported in the folded
+ *	stack format understood by common flame graph tools. Each thread records
+ *	its own tree; all static member functions refer to the calling thread.
+ */
+class Profiler
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Enables recording of profiler sections.
+		 */
+		static inline void enable( );
+
+		/** Disables recording of profiler sections. Already recorded
+		 *	data is kept.
+		 */
+		static inline void disable( );
+
+		/** Returns whether profiler sections are recorded.
+		 *
+		 *	\return BT_TRUE  iff profiler is enabled, \n
+		 *	        BT_FALSE otherwise
+		 */
+		static inline BooleanType isEnabled( );
+
+		/** Clears all data recorded by the calling thread.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		static returnValue reset( );
+
+
+		/** Opens a (nested) section with given name. The name is expected
+		 *	to be a string literal, i.e. it must not be freed while the
+		 *	profiler data is in use.
+		 *
+		 *	@param[in] name		Name of the section.
+		 */
+		static void enterSection(	const char* name
+									);
+
+		/** Closes the section opened most recently.
+		 */
+		static void leaveSection( );
+
+
+		/** Returns accumulated time and number of calls of all sections
+		 *	with given name, summed over all call paths.
+		 *
+		 *	@param[in]  name		Name of the section.
+		 *	@param[out] totalTime	Total time spent in section [sec].
+		 *	@param[out] numCalls	Number of calls of section.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		static returnValue getSectionTime(	const std::string& name,
+											double& totalTime,
+											uint& numCalls
+											);
+
+		/** Prints the recorded section tree as table.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *	@param[in] name		If not empty, only the subtrees rooted at sections
+		 *						with this name are printed.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		static returnValue print(	std::ostream& stream = std::cout,
+									const std::string& name = std::string()
+									);
+
+		/** Prints the recorded section tree in folded stack format, i.e. one line
+		 *	"root;child;...;section <self time [ns]>" per call path, which can
+		 *	directly be fed into flame graph tools.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		static returnValue printFoldedStacks(	std::ostream& stream
+												);
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+
+#ifdef ACADO_HAS_CXX11
+		static std::atomic< bool > enabled;	/**< Flag indicating whether sections are recorded (shared by all threads). */
+#else
+		static bool enabled;			/**< Flag indicating whether sections are recorded. */
+#endif
+};
+
+
+/** 
+ *	\brief Scoped section of the hierarchical run-time profiler.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class ProfilerSection opens a profiler section on construction and
+ *	closes it on destruction. It does nothing if the profiler is disabled
+ *	at construction.
+ */
+class ProfilerSection
+{
+	public:
+
+		/** Constructor which opens a section with given name.
+		 *
+		 *	@param[in] name		Name of the section (string literal).
+		 */
+		inline ProfilerSection(	const char* name
+								);
+
+		/** Destructor which closes the section.
+		 */
+		inline ~ProfilerSection( );
+
+	private:
+
+		ProfilerSection( const ProfilerSection& );
+		ProfilerSection& operator=( const ProfilerSection& );
+
+		BooleanType isActive;			/**< Flag indicating whether section has been opened. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#define ACADO_PROFILE_CONCAT_( a,b ) a##b
+#define ACADO_PROFILE_CONCAT( a,b ) ACADO_PROFILE_CONCAT_( a,b )
+
+/** Opens a profiler section with given name until the end of the enclosing scope. */
+#ifdef ACADO_DISABLE_PROFILER
+	#define ACADO_PROFILE( name )
+#else
+	#define ACADO_PROFILE( name ) \
+		REFER_NAMESPACE_ACADO ProfilerSection ACADO_PROFILE_CONCAT( acadoProfilerSection,__LINE__ )( name )
+#endif
+
+
+#include <acado/clock/profiler.ipp>
+
+
+#endif	// ACADO_TOOLKIT_PROFILER_HPP
+
+
+/*
+ *	end of file
+ */
@@ -34,9 +34,19 @@
 #include <acado/code_generation/export_acado_function.hpp>
 #include <acado/function/function_.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <mutex>
+#endif
+
 using namespace std;
 BEGIN_NAMESPACE_ACADO
 
+#ifdef ACADO_HAS_CXX11
+/** Serializes the export of symbolic functions, as their expression trees may
+ *	share nodes whose export names are set while exporting. */
+static std::mutex symbolicExportMutex;
+#endif
+
 
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -154,6 +164,10 @@ returnValue ExportAcadoFunction::exportCode(	std::ostream& stream,
 	if (external == true)
 		return SUCCESSFUL_RETURN;
 
+#ifdef ACADO_HAS_CXX11
+	std::lock_guard< std::mutex > lock( symbolicExportMutex );
+#endif
+
 	return f->exportCode(
 			stream, name.c_str(), _realString.c_str(), numX, numXA, numU, numP, numDX, numOD,
 			// TODO: Here we allocate local memory for the function, this should be extended.
@@ -220,20 +220,20 @@ returnValue ExportArithmeticStatement::exportCodeAddSubtract(	std::ostream& stre
 						continue;
 				}
 
-				stream << lhs.get(i, j) << " " << getAssignString();
+				lhs->exportComponent(stream, i, j) << " " << getAssignString();
 
 				if ( rhs1->isZero(i, j) == false )
 				{
-					stream  << " " << rhs1->get(i, j);
+					rhs1->exportComponent(stream << " ", i, j);
 					if ( rhs2->isZero(i,j) == false )
-						stream  << " " << _sign << " " << rhs2->get(i, j) << ";\n";
+						rhs2->exportComponent(stream << " " << _sign << " ", i, j) << ";\n";
 					else
 						stream << ";" << endl;
 				}
 				else
 				{
 					if (rhs2->isZero(i, j) == false)
-						stream  << " " << _sign << " " << rhs2->get(i, j) << ";\n";
+						rhs2->exportComponent(stream << " " << _sign << " ", i, j) << ";\n";
 					else
 						stream << " 0.0;\n";
 				}
@@ -351,56 +351,55 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 		// Unroll all loops
 		//
 
+		unsigned iRhs1, kRhs1;
+
 		for(uint i = 0; i < getNumRows( ); ++i)
 		{
-			ii = i;
-
 			for(uint j = 0; j < getNumCols( ); ++j)
 			{
 				allZero = true;
 
-				stream << lhs->get(ii,j) <<  " " << getAssignString();
+				lhs->exportComponent(stream, i, j) <<  " " << getAssignString();
 
 				for(uint k = 0; k < nColsRhs1; ++k)
 				{
-					kk = k;
 					if ( transposeRhs1 == false )
 					{
-						iiRhs1 = ii;
-						kkRhs1 = kk;
+						iRhs1 = i;
+						kRhs1 = k;
 					}
 					else
 					{
-						iiRhs1 = kk;
-						kkRhs1 = ii;
+						iRhs1 = k;
+						kRhs1 = i;
 					}
 
-					if ( ( rhs1->isZero(iiRhs1,kkRhs1) == false ) &&
-							( rhs2->isZero(kk,j) == false ) )
+					if ( ( rhs1->isZero(iRhs1,kRhs1) == false ) &&
+							( rhs2->isZero(k,j) == false ) )
 					{
 						allZero = false;
 
-						if ( rhs1->isOne(iiRhs1,kkRhs1) == false )
+						if ( rhs1->isOne(iRhs1,kRhs1) == false )
 						{
-							stream << " " << sign << " " << rhs1->get(iiRhs1,kkRhs1);
+							rhs1->exportComponent(stream << " " << sign << " ", iRhs1, kRhs1);
 
-							if ( rhs2->isOne(kk,j) == false )
-								stream << "*" << rhs2->get(kk, j);
+							if ( rhs2->isOne(k,j) == false )
+								rhs2->exportComponent(stream << "*", k, j);
 						}
 						else
 						{
-							if ( rhs2->isOne(kk,j) == false )
-								stream << " " << sign << rhs2->get(kk,j);
+							if ( rhs2->isOne(k,j) == false )
+								rhs2->exportComponent(stream << " " << sign, k, j);
 							else
 								stream << " " << sign << " 1.0";
 						}
 					}
 				}
 
-				if (op2 == ESO_ADD && rhs3->isZero(ii, j) == false)
-					stream << " + " << rhs3->get(ii, j);
-				if (op2 == ESO_SUBTRACT && rhs3->isZero(ii, j) == false)
-					stream << " - " << rhs3->get(ii, j);
+				if (op2 == ESO_ADD && rhs3->isZero(i, j) == false)
+					rhs3->exportComponent(stream << " + ", i, j);
+				if (op2 == ESO_SUBTRACT && rhs3->isZero(i, j) == false)
+					rhs3->exportComponent(stream << " - ", i, j);
 				if (op2 == ESO_UNDEFINED && allZero == true)
 					stream << " 0.0;\n";
 
@@ -572,23 +571,29 @@ returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 	}
 	else if ((numOps < 128) || (rhs1.isGiven() == true))
 	{
+		// checking whether rhs1 is given requires a pass over all its
+		// components, thus it must not be done for each component again
+		const bool isRhs1Given = rhs1->isGiven();
+		const DMatrix& rhs1Values = rhs1->getGivenMatrix();
+		const bool isAssignment = ( _op == "=" );
+
 		for(unsigned i = 0; i < lhs.getNumRows( ); ++i)
 			for(unsigned j = 0; j < lhs.getNumCols( ); ++j)
-				if ( ( _op == "=" ) || ( rhs1.isZero(i,j) == false ) )
+				if ( ( isAssignment == true ) || ( rhs1.isZero(i,j) == false ) )
 				{
-					stream << lhs->get(i, j) << " " << _op << " ";
-					if (rhs1->isGiven() == true)
+					lhs->exportComponent(stream, i, j) << " " << _op << " ";
+					if (isRhs1Given == true)
 					{
 						if (lhs->getType() == REAL || lhs->getType() == STATIC_CONST_REAL)
-							stream << scientific << rhs1(i, j);
+							stream << scientific << rhs1Values(i, j);
 						else
-							stream << (int)rhs1(i, j);
+							stream << (int)rhs1Values(i, j);
 
 						stream <<  ";\n";
 					}
 					else
 					{
-						stream << rhs1->get(i, j) << ";\n";
+						rhs1->exportComponent(stream, i, j) << ";\n";
 					}
 				}
 	}
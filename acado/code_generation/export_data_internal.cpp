@@ -189,7 +189,7 @@ std::string ExportDataInternal::getDataStructString( ) const
 }
 
 
-std::string ExportDataInternal::getFullName( ) const
+const std::string& ExportDataInternal::getFullName( ) const
 {
 	if ( fullName.empty() == true )
 		return name;
@@ -135,7 +135,7 @@ public:
 	 *
 	 *	\return Full name of the data object
 	 */
-	std::string getFullName( ) const;
+	const std::string& getFullName( ) const;
 
 
 	/** Exports declaration of the index variable. Its appearance can
@@ -220,8 +220,9 @@ returnValue ExportExactHessianCN2::setupObjectiveEvaluation( void )
 returnValue ExportExactHessianCN2::setupHessianRegularization( )
 {
 	ExportVariable block( "hessian_block", NX+NU, NX+NU );
-	regularization = ExportFunction( "acado_regularize", block );
-	regularization.doc( "EVD-based regularization of a Hessian block." );
+	ExportIndex blockIdx( "blockIdx" );
+	regularization = ExportFunction( "acado_regularize", block, blockIdx );
+	regularization.doc( "Regularization of a Hessian block, blockIdx is the index of the block within the horizon." );
 	regularization.addLinebreak();
 
 	regularizeHessian.setup( "regularizeHessian" );
@@ -231,7 +232,7 @@ returnValue ExportExactHessianCN2::setupHessianRegularization( )
 	regularizeHessian.acquire( oInd );
 
 	ExportForLoop loopObjective(oInd, 0, N);
-	loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0) );
+	loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0), oInd );
 	loopObjective.addStatement( Q1.getRows(oInd*NX, oInd*NX+NX) == objS.getSubMatrix(oInd*(NX+NU), oInd*(NX+NU)+NX, 0, NX) );
 	loopObjective.addStatement( S1.getRows(oInd*NX, oInd*NX+NX) == objS.getSubMatrix(oInd*(NX+NU), oInd*(NX+NU)+NX, NX, NX+NU) );
 	loopObjective.addStatement( R1.getRows(oInd*NU, oInd*NU+NU) == objS.getSubMatrix(oInd*(NX+NU)+NX, oInd*(NX+NU)+NX+NU, NX, NX+NU) );
@@ -120,8 +120,11 @@ returnValue ExportExactHessianQpDunes::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -292,8 +295,9 @@ returnValue ExportExactHessianQpDunes::setupObjectiveEvaluation( void )
 returnValue ExportExactHessianQpDunes::setupHessianRegularization( )
 {
 	ExportVariable block( "hessian_block", NX+NU, NX+NU );
-	regularization = ExportFunction( "acado_regularize", block );
-	regularization.doc( "EVD-based regularization of a Hessian block." );
+	ExportIndex blockIdx( "blockIdx" );
+	regularization = ExportFunction( "acado_regularize", block, blockIdx );
+	regularization.doc( "Regularization of a Hessian block, blockIdx is the index of the block within the horizon." );
 	regularization.addLinebreak();
 
 	regularizeHessian.setup( "regularizeHessian" );
@@ -303,7 +307,7 @@ returnValue ExportExactHessianQpDunes::setupHessianRegularization( )
 	regularizeHessian.acquire( oInd );
 
 	ExportForLoop loopObjective(oInd, 0, N);
-	loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0) );
+	loopObjective.addFunctionCall( regularization, objS.getAddress(oInd*(NX+NU),0), oInd );
 	for( uint row = 0; row < NX+NU; row++ ) {
 		loopObjective.addStatement( qpH.getRows((oInd*(NX+NU)+row)*(NX+NU),(oInd*(NX+NU)+row+1)*(NX+NU)) == objS.getRow(oInd*(NX+NU)+row).getTranspose() );
 	}
@@ -64,10 +64,10 @@ ExportFile::~ExportFile( )
 
 returnValue ExportFile::exportCode( ) const
 {
-	ofstream stream( fileName.c_str() );
-
-	if (stream.good() == false)
-		return ACADOERROR( RET_DOES_DIRECTORY_EXISTS );
+	// The code is generated in memory first and the file is only written
+	// if its content has changed, such that timestamp-based builds of the
+	// exported code only recompile what has actually been modified.
+	stringstream stream;
 
 	acadoPrintAutoGenerationNotice(stream, commentString);
 
@@ -76,9 +76,13 @@ returnValue ExportFile::exportCode( ) const
 
 	returnValue returnvalue = ExportStatementBlock::exportCode(stream, realString, intString, precision);
 
-	stream.close();
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	if ( acadoWriteFileIfChanged(fileName, stream.str()) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_DOES_DIRECTORY_EXISTS );
 
-	return returnvalue;
+	return SUCCESSFUL_RETURN;
 }
 
 CLOSE_NAMESPACE_ACADO
@@ -358,10 +358,23 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
-	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	if( regularizeHessian.isDefined() )
+	{
+		addTimingCounterStart(preparation, "ACADO_TIMING_REGULARIZATION");
+		preparation.addFunctionCall( regularizeHessian );
+		addTimingCounterStop(preparation, "ACADO_TIMING_REGULARIZATION");
+	}
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( evaluateConstraints );
 
 	preparation.addLinebreak();
@@ -386,8 +399,11 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportVariable SlxCall =
 				objSlx.isGiven() == true || variableObjS == false ? objSlx : objSlx.getRows(N * NX, (N + 1) * NX);
 	preparation.addStatement( objGradients[ getNumberOfBlocks() ] += SlxCall );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addLinebreak();
 
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Feedback phase
@@ -402,10 +418,14 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	feedback.setReturnValue( tmp );
 	feedback.addIndex( index );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	if (initialStateFixed() == true)
 	{
 		feedback.addStatement( cond[ 0 ] == x0 - x.getRow( 0 ).getTranspose() );
 	}
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
 	//
@@ -439,21 +459,27 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportFunction solveQP;
 	solveQP.setup("solve");
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback
 	<< tmp.getFullName() << " = "
 	<< qpModuleName << "_" << solveQP.getName() << "( "
 	<< "&" << qpObjPrefix << "_" << "params" << ", "
 	<< "&" << qpObjPrefix << "_" << "output" << ", "
 	<< "&" << qpObjPrefix << "_" << "info" << " );\n";
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	for (unsigned i = 0; i < getNumberOfBlocks(); ++i) {
 		feedback.addFunctionCall( expand, vecQPVars[i], ExportIndex(i) );
 	}
 
 	feedback.addStatement( x.getRow( N ) += vecQPVars[ getNumberOfBlocks() ].getTranspose() );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addLinebreak();
 
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Setup evaluation of the KKT tolerance
@@ -95,10 +95,23 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
-	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	if( regularizeHessian.isDefined() )
+	{
+		addTimingCounterStart(preparation, "ACADO_TIMING_REGULARIZATION");
+		preparation.addFunctionCall( regularizeHessian );
+		addTimingCounterStop(preparation, "ACADO_TIMING_REGULARIZATION");
+	}
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( evaluateConstraints );
 
 	preparation.addLinebreak();
@@ -128,8 +141,11 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	stringstream prep;
 	prep << retSim.getName() << " = prepareQpDunes( );" << endl;
 	preparation << prep.str();
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addLinebreak();
 
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Feedback phase
@@ -144,6 +160,9 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	feedback.setReturnValue( tmp );
 	feedback.addIndex( index );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	if (initialStateFixed() == true)
 	{
 		feedback.addStatement( qpLb0.getTranspose().getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose() );
@@ -153,18 +172,25 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	{
 		feedback << (qpgN == g.getRows(getNumberOfBlocks()*getNumBlockVariables(), getNumQPvars()));
 	}
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
 	stringstream s;
 	s << tmp.getName() << " = solveQpDunes( );" << endl;
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback <<  s.str();
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	ExportForLoop expandLoop( index, 0, getNumberOfBlocks() );
 	expandLoop.addFunctionCall( expand, index );
 	feedback.addStatement( expandLoop );
 
 	feedback.addStatement( (x.getRow(getNumberOfBlocks()*getBlockSize())).getTranspose() += xVars.getRows(getNumberOfBlocks()*getNumBlockVariables(), getNumberOfBlocks()*getNumBlockVariables()+NX) );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
+
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -169,8 +169,11 @@ returnValue ExportGaussNewtonCN2::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -1497,11 +1500,26 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
-	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	if( regularizeHessian.isDefined() )
+	{
+		addTimingCounterStart(preparation, "ACADO_TIMING_REGULARIZATION");
+		preparation.addFunctionCall( regularizeHessian );
+		addTimingCounterStop(preparation, "ACADO_TIMING_REGULARIZATION");
+	}
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( condensePrep );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -1519,15 +1537,25 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addFunctionCall( condenseFdb );
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
 	stringstream s;
 	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback <<  s.str();
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addFunctionCall( expand );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
+
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
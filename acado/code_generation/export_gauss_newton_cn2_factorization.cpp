@@ -177,8 +177,11 @@ returnValue ExportGaussNewtonCn2Factorization::getCode(	ExportStatementBlock& co
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -1783,10 +1786,20 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( condensePrep );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -1804,15 +1817,25 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addFunctionCall( condenseFdb );
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
 	stringstream s;
 	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback <<  s.str();
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addFunctionCall( expand );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
+
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
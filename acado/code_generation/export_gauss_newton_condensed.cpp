@@ -179,8 +179,11 @@ returnValue ExportGaussNewtonCondensed::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -2249,10 +2252,20 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( condensePrep );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -2270,19 +2283,29 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( tmp );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addFunctionCall( condenseFdb );
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback << tmp.getName() << " = " << solve.getName() << "( );\n";
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addFunctionCall( expand );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
 
 	int covCalc;
 	get(CG_COMPUTE_COVARIANCE_MATRIX, covCalc);
 	if (covCalc)
 		feedback.addFunctionCall( calculateCovariance );
 
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Setup evaluation of the KKT tolerance
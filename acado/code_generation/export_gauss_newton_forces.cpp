@@ -133,8 +133,11 @@ returnValue ExportGaussNewtonForces::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -924,10 +927,21 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( evaluateConstraints );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -941,6 +955,9 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	feedback.doc( "Feedback/estimation step of the RTI scheme." );
 	feedback.setReturnValue( returnValueFeedbackPhase );
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addStatement(
 			//			cond[ 0 ].getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose()
 			cond[ 0 ] == x0 - x.getRow( 0 ).getTranspose()
@@ -954,6 +971,7 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	for (unsigned i = 0; i < N; ++i)
 		feedback.addFunctionCall(setStagef, objGradients[ i ], ExportIndex( i ));
 	feedback.addStatement( objGradients[ N ] == QN2 * DyN );
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
 	//
@@ -1016,12 +1034,14 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	ExportFunction solveQP;
 	solveQP.setup("solve");
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback
 	<< returnValueFeedbackPhase.getFullName() << " = "
 	<< qpModuleName << "_" << solveQP.getName() << "( "
 	<< "&" << qpObjPrefix << "_" << "params" << ", "
 	<< "&" << qpObjPrefix << "_" << "output" << ", "
 	<< "&" << qpObjPrefix << "_" << "info" << " );\n";
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 	feedback.addLinebreak();
 
 	//
@@ -1037,13 +1057,17 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	acc.addStatement( u.getRow( index ) += stageOut.getCols(NX, NX + NU) );
 	acc.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	for (unsigned i = 0; i < N; ++i)
 		feedback.addFunctionCall(acc, vecQPVars[ i ], ExportIndex( i ));
 	feedback.addLinebreak();
 
 	feedback.addStatement( x.getRow( N ) += vecQPVars[ N ].getTranspose() );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addLinebreak();
 
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// TODO Setup evaluation of KKT
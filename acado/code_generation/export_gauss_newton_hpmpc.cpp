@@ -161,8 +161,11 @@ returnValue ExportGaussNewtonHpmpc::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -594,10 +597,21 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( evaluateConstraints );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -630,7 +644,11 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// Temporary hack for the workspace
 		feedback << "static real_t qpWork[ HPMPC_RIC_MHE_IF_DP_WORK_SPACE ];\n";
 	}
-	else
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
+	if (initialStateFixed() == true)
 	{
 		// State feedback
 		feedback.addStatement( qpx.getRows(0, NX) == x0 - x.getRow( 0 ).getTranspose() );
@@ -658,12 +676,14 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// It is assumed this is the shifted version from the previous time step!
 		feedback.addStatement( DxAC == xAC - x.getRow( 0 ).getTranspose() );
 	}
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 
 	//
 	// Here we have to add the differences....
 	//
 
 	// Call the solver
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	if (initialStateFixed() == true)
 		feedback
 			<< returnValueFeedbackPhase.getFullName() << " = " << "acado_hpmpc_ip_wrapper("
@@ -739,9 +759,12 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 	double *lam, double *work0 );
 	*/
 
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
+
 	// XXX Not 100% sure about this one
 
 	// Accumulate the solution, i.e. perform full Newton step
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	feedback.addStatement( x.makeColVector() += qpx );
 	feedback.addStatement( u.makeColVector() += qpu );
 
@@ -750,6 +773,9 @@ returnValue ExportGaussNewtonHpmpc::setupEvaluation( )
 		// This is the arrival cost for the next time step!
 		feedback.addStatement( xAC == x.getRow( 1 ).getTranspose() + DxAC );
 	}
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
+
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -164,8 +164,11 @@ returnValue ExportGaussNewtonQpDunes::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		if (usesWorkerPool() == true)
+			code << "#pragma omp threadprivate( " << state.getFullName() << " )\n\n";
 	}
 
+	code.addFunction( modelSimulationNodes );
 	code.addFunction( modelSimulation );
 
 	code.addFunction( evaluateStageCost );
@@ -999,11 +1002,27 @@ returnValue ExportGaussNewtonQpDunes::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_PREPARATION");
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_INTEGRATION");
 	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	addTimingCounterStop(preparation, "ACADO_TIMING_INTEGRATION");
 
+	addTimingCounterStart(preparation, "ACADO_TIMING_OBJECTIVE");
 	preparation.addFunctionCall( evaluateObjective );
-	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
+	addTimingCounterStop(preparation, "ACADO_TIMING_OBJECTIVE");
+	if( regularizeHessian.isDefined() )
+	{
+		addTimingCounterStart(preparation, "ACADO_TIMING_REGULARIZATION");
+		preparation.addFunctionCall( regularizeHessian );
+		addTimingCounterStop(preparation, "ACADO_TIMING_REGULARIZATION");
+	}
+
+	addTimingCounterStart(preparation, "ACADO_TIMING_CONDENSING_PREP");
 	preparation.addFunctionCall( evaluateConstraints );
+	addTimingCounterStop(preparation, "ACADO_TIMING_CONDENSING_PREP");
+
+	addTimingCounterStop(preparation, "ACADO_TIMING_PREPARATION");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -1021,9 +1040,12 @@ returnValue ExportGaussNewtonQpDunes::setupEvaluation( )
 	qpLambda.setup("qpLambda", N * NX, 1, REAL, ACADO_WORKSPACE);
 	qpMu.setup("qpMu", 2 * N * (NX + NU) + 2 * NX, 1, REAL, ACADO_WORKSPACE);
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_FEEDBACK");
+
 	//
 	// Calculate objective residuals and call the QP solver
 	//
+	addTimingCounterStart(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	if( getNY() > 0 || getNYN() > 0 ) {
 		feedback.addStatement( Dy -= y );
 		feedback.addLinebreak();
@@ -1049,9 +1071,12 @@ returnValue ExportGaussNewtonQpDunes::setupEvaluation( )
 	{
 		feedback << (qpgN == qpg.getRows(N * (NX + NU), N * (NX + NU) + NX));
 	}
+	addTimingCounterStop(feedback, "ACADO_TIMING_CONDENSING_FDB");
 	feedback.addLinebreak();
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_QP");
 	feedback << returnValueFeedbackPhase.getFullName() << " = solveQpDunes();\n";
+	addTimingCounterStop(feedback, "ACADO_TIMING_QP");
 
 	//
 	// Here we have to accumulate the differences.
@@ -1064,6 +1089,7 @@ returnValue ExportGaussNewtonQpDunes::setupEvaluation( )
 	acc	<< (x.getRow( index ) += stageOut.getCols(0, NX))
 		<< (u.getRow( index ) += stageOut.getCols(NX, NX + NU));
 
+	addTimingCounterStart(feedback, "ACADO_TIMING_EXPANSION");
 	for (unsigned i = 0; i < N; ++i)
 		feedback.addFunctionCall(acc, qpPrimal.getAddress(i * (NX + NU)), ExportIndex( i ));
 	feedback.addLinebreak();
@@ -1079,6 +1105,9 @@ returnValue ExportGaussNewtonQpDunes::setupEvaluation( )
 	get( HESSIAN_APPROXIMATION, hessianApproximation );
 	bool secondOrder = ((HessianApproximationMode)hessianApproximation == EXACT_HESSIAN);
 	if( secondOrder )	feedback.addStatement( mu.makeColVector() == qpLambda );
+	addTimingCounterStop(feedback, "ACADO_TIMING_EXPANSION");
+
+	addTimingCounterStop(feedback, "ACADO_TIMING_FEEDBACK");
 
 	////////////////////////////////////////////////////////////////////////////
 	//
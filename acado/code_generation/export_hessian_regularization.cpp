@@ -51,7 +51,11 @@ ExportHessianRegularization::ExportHessianRegularization(	const std::string& _so
 }
 
 
-returnValue ExportHessianRegularization::configure( uint DIM, double eps )
+returnValue ExportHessianRegularization::configure(	uint DIM,
+														double eps,
+														HessianRegularizationMode mode,
+														uint numBlocks
+														)
 {
 	//
 	// Source file configuration
@@ -66,6 +70,14 @@ returnValue ExportHessianRegularization::configure( uint DIM, double eps )
 	ss << eps;
 	dictionary[ "@MODULE_EPS@" ] = ss.str();
 
+	ss.str( string() );
+	ss << (int)mode;
+	dictionary[ "@MODULE_REG_MODE@" ] = ss.str();
+
+	ss.str( string() );
+	ss << (numBlocks > 0 ? numBlocks : 1);
+	dictionary[ "@MODULE_NUM_BLOCKS@" ] = ss.str();
+
 	fillTemplate();
 
 	return SUCCESSFUL_RETURN;
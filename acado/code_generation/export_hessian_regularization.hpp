@@ -39,6 +39,11 @@ BEGIN_NAMESPACE_ACADO
 /**
  *	\brief A class for generating code implementing a symmetric EigenValue Decomposition.
  *
+ *	The generated code regularizes the Hessian blocks either with a full
+ *	eigenvalue decomposition, with an eigenvalue decomposition warm-started from
+ *	the eigenbasis of the previous iteration or with a Cholesky factorization
+ *	attempt followed by a diagonal shift when the factorization fails.
+ *
  *	\ingroup ExportHessianRegularization
  *
  *	\author Rien Quirynen
@@ -72,10 +77,19 @@ public:
 	{}
 
 	/** Configure the template
+	 *
+	 *	@param[in] DIM			Dimension of a Hessian block.
+	 *	@param[in] eps			Lower bound on the eigenvalues of a regularized block.
+	 *	@param[in] mode			Regularization strategy.
+	 *	@param[in] numBlocks	Number of Hessian blocks, needed to store eigenbases for warm starts.
 	 *
 	 *  \return SUCCESSFUL_RETURN
 	 */
-	returnValue configure(	uint DIM, double eps );
+	returnValue configure(	uint DIM,
+							double eps,
+							HessianRegularizationMode mode = EVD_MIRRORING,
+							uint numBlocks = 1
+							);
 
 private:
 
@@ -33,10 +33,29 @@
 
 #include <acado/code_generation/export_module.hpp>
 #include <acado/code_generation/integrators/integrator_export.hpp>
+#include <acado/code_generation/export_file.hpp>
+
+#ifdef ACADO_HAS_CXX11
+#include <system_error>
+#include <thread>
+#endif
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Exports every numThreads-th file, starting with the given one, possibly
+ *	within a separate thread. */
+static void exportFileRange(	const std::vector< const ExportFile* >* files,
+								unsigned first,
+								unsigned numThreads,
+								std::vector< returnValue >* returnvalues
+								)
+{
+	for (unsigned i = first; i < files->size(); i += numThreads)
+		(*returnvalues)[ i ] = (*files)[ i ]->exportCode( );
+}
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -56,6 +75,58 @@ ExportModule::~ExportModule( )
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue ExportModule::exportFiles(	const std::vector< const ExportFile* >& files
+										) const
+{
+	int numThreads;
+	get(CG_EXPORT_NUM_THREADS, numThreads);
+
+	if (numThreads > (int)files.size())
+		numThreads = files.size();
+	if (numThreads < 1)
+		numThreads = 1;
+
+	std::vector< returnValue > returnvalues(files.size(), SUCCESSFUL_RETURN);
+
+	// Export handles are shared between files, which relies on the atomic
+	// reference counting of GCC-compatible builds; it is switched on only
+	// while several threads run, as it slows down all other uses
+#if defined(ACADO_HAS_CXX11) && defined(__GNUC__)
+	if (numThreads > 1)
+		CasADi::SharedObject::beginConcurrentAccess();
+
+	std::vector< std::thread > threads;
+	try
+	{
+		for (int i = 1; i < numThreads; ++i)
+			threads.push_back( std::thread(exportFileRange, &files, i, numThreads, &returnvalues) );
+	}
+	catch (const std::system_error&)
+	{
+		// no more threads available, export their files in this one
+	}
+
+	exportFileRange(&files, 0, numThreads, &returnvalues);
+	for (int i = threads.size() + 1; i < numThreads; ++i)
+		exportFileRange(&files, i, numThreads, &returnvalues);
+
+	for (unsigned i = 0; i < threads.size(); ++i)
+		threads[ i ].join();
+
+	if (numThreads > 1)
+		CasADi::SharedObject::endConcurrentAccess();
+#else
+	exportFileRange(&files, 0, 1, &returnvalues);
+#endif
+
+	for (unsigned i = 0; i < returnvalues.size(); ++i)
+		if (returnvalues[ i ] != SUCCESSFUL_RETURN)
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ExportModule::setupOptions( )
 {
 	addOption( HESSIAN_APPROXIMATION,       GAUSS_NEWTON    );
@@ -94,9 +165,14 @@ returnValue ExportModule::setupOptions( )
 	addOption( CG_USE_OPENMP,					 NO         );
 	addOption( CG_HARDCODE_CONSTRAINT_VALUES,    YES        );
 	addOption( CG_USE_ARRIVAL_COST,              NO         );
+	addOption( CG_USE_TIMING_COUNTERS,           NO         );
+	addOption( CG_BATCH_INTEGRATOR_BLOCK_SIZE,   0          );
+	addOption( CG_USE_WORKER_POOL,               NO         );
+	addOption( CG_EXPORT_NUM_THREADS,            1          );
 
 	addOption( CG_CONDENSED_HESSIAN_CHOLESKY,    EXTERNAL   );
 	addOption( CG_FORCE_DIAGONAL_HESSIAN,        NO         );
+	addOption( CG_HESSIAN_REGULARIZATION,        EVD_MIRRORING );
 
 	addOption( CG_MODULE_NAME, "acado"						);
 	addOption( CG_EXPORT_FOLDER_NAME, "acado_export"		);
@@ -40,6 +40,7 @@
 BEGIN_NAMESPACE_ACADO
 
 class ExportStatementBlock;
+class ExportFile;
 
 /** 
  *	\brief User-interface to automatically generate algorithms for fast model predictive control
@@ -125,6 +126,19 @@ protected:
 	virtual returnValue collectFunctionDeclarations(	ExportStatementBlock& declarations
 														) const = 0;
 
+	/** Exports given files, which have to be completely set up before. Files are
+	 *	written concurrently on up to CG_EXPORT_NUM_THREADS threads, such that they
+	 *	must not share any statements; code of symbolic functions is still exported
+	 *	one function at a time.
+	 *
+	 *	@param[in] files			Files to be exported.
+	 *
+	 *	\return SUCCESSFUL_RETURN, \n
+	 *	        RET_UNABLE_TO_EXPORT_CODE
+	 */
+	returnValue exportFiles(	const std::vector< const ExportFile* >& files
+								) const;
+
 	/** Sets-up default options.
 	 *
 	 *  \return SUCCESSFUL_RETURN
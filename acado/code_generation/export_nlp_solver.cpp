@@ -86,6 +86,19 @@ bool ExportNLPSolver::performsSingleShooting( ) const
 	return false;
 }
 
+bool ExportNLPSolver::usesWorkerPool( ) const
+{
+	int useOMP, useWorkerPool;
+	get(CG_USE_OPENMP, useOMP);
+	get(CG_USE_WORKER_POOL, useWorkerPool);
+
+	// Only the shooting nodes of a multiple shooting discretization are independent
+	if (useOMP && useWorkerPool && performsSingleShooting() == false)
+		return true;
+
+	return false;
+}
+
 returnValue ExportNLPSolver::getDataDeclarations(	ExportStatementBlock& declarations,
 													ExportStruct dataStruct
 													) const
@@ -182,6 +195,9 @@ returnValue ExportNLPSolver::setupInitialization()
 	initialize	<< "memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));" << "\n";
 //	initialize	<< "memset(&acadoVariables, 0, sizeof( acadoVariables ));" << "\n";
 
+	if (usesWorkerPool() == true)
+		initialize << "workerPoolStart( );\n";
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -202,8 +218,23 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	modelSimulation.setReturnValue(retSim, false);
 	modelSimulation.addStatement(retSim == 0);
 	ExportIndex run;
-	modelSimulation.acquire( run );
-	ExportForLoop loop(run, 0, getN());
+	ExportForLoop loop;
+
+	if (usesWorkerPool() == true)
+	{
+		// The shooting nodes are distributed over the threads of the worker pool,
+		// each of them simulating a contiguous range of nodes
+		ExportIndex firstNode( "firstNode" ), lastNode( "lastNode" );
+		modelSimulationNodes.setup("modelSimulationNodes", firstNode, lastNode);
+		modelSimulationNodes.addVariable( retSim );
+		modelSimulationNodes.acquire( run );
+		loop.init(run, firstNode, lastNode, 1, false);
+	}
+	else
+	{
+		modelSimulation.acquire( run );
+		loop.init(run, 0, getN(), 1, false);
+	}
 
 	int useOMP;
 	get(CG_USE_OPENMP, useOMP);
@@ -263,7 +294,7 @@ returnValue ExportNLPSolver::setupSimulation( void )
 		modelSimulation.addLinebreak( );
 	}
 
-	if ( useOMP )
+	if (useOMP && usesWorkerPool() == false)
 	{
 
 		modelSimulation
@@ -369,7 +400,15 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	// XXX This should be revisited at some point
 	//	modelSimulation.release( run );
 
-	modelSimulation.addStatement( loop );
+	if (usesWorkerPool() == true)
+	{
+		modelSimulationNodes.addStatement( loop );
+		modelSimulation << "workerPoolRun( " << modelSimulationNodes.getName() << ", " << toString( getN() ) << " );\n";
+	}
+	else
+	{
+		modelSimulation.addStatement( loop );
+	}
 
 	return SUCCESSFUL_RETURN;
 }
@@ -2001,4 +2040,30 @@ returnValue ExportNLPSolver::setupArrivalCostCalculation()
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue ExportNLPSolver::addTimingCounterStart(	ExportStatementBlock& code,
+													const std::string& phase
+													) const
+{
+	int useTimingCounters;
+	get(CG_USE_TIMING_COUNTERS, useTimingCounters);
+
+	if ( useTimingCounters )
+		code << "timingCounterStart( " << phase << " );\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ExportNLPSolver::addTimingCounterStop(	ExportStatementBlock& code,
+													const std::string& phase
+													) const
+{
+	int useTimingCounters;
+	get(CG_USE_TIMING_COUNTERS, useTimingCounters);
+
+	if ( useTimingCounters )
+		code << "timingCounterStop( " << phase << " );\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
 CLOSE_NAMESPACE_ACADO
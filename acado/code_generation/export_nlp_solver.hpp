@@ -148,6 +148,15 @@ public:
 	 */
 	bool performsSingleShooting( ) const;
 
+	/** Returns whether the shooting nodes are simulated by the persistent worker
+	 *  pool of the exported solver, i.e. whether CG_USE_WORKER_POOL and
+	 *  CG_USE_OPENMP are enabled for a multiple shooting discretization.
+	 *
+	 *	\return true  iff the worker pool is used, \n
+	 *	        false otherwise
+	 */
+	bool usesWorkerPool( ) const;
+
 	/** Set objective function
 	 *  \return SUCCESSFUL_RETURN, \n
 	 *          RET_INITIALIZE_FIRST, \n
@@ -224,6 +233,30 @@ protected:
 	/** Setup main initialization code for the solver */
 	virtual returnValue setupInitialization();
 
+	/** Adds a call starting the timing counter of a solver phase, if
+	 *  CG_USE_TIMING_COUNTERS is enabled.
+	 *
+	 *	@param[in] code		Statement block the call is added to.
+	 *	@param[in] phase	Name of the phase, e.g. "ACADO_TIMING_QP".
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue addTimingCounterStart(	ExportStatementBlock& code,
+										const std::string& phase
+										) const;
+
+	/** Adds a call stopping the timing counter of a solver phase, if
+	 *  CG_USE_TIMING_COUNTERS is enabled.
+	 *
+	 *	@param[in] code		Statement block the call is added to.
+	 *	@param[in] phase	Name of the phase, e.g. "ACADO_TIMING_QP".
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue addTimingCounterStop(	ExportStatementBlock& code,
+										const std::string& phase
+										) const;
+
 protected:
 
 	/** \name Evaluation of model dynamics. */
@@ -233,6 +266,7 @@ protected:
 	IntegratorExportPtr integrator;
 
 	ExportFunction modelSimulation;
+	ExportFunction modelSimulationNodes; // simulation of a range of shooting nodes, run by the worker pool
 
 	ExportVariable state;
 	ExportVariable x;
@@ -202,6 +202,14 @@ bool ExportVariable::isZero(	const ExportIndex& rowIdx,
 }
 
 
+bool ExportVariable::isZero(	unsigned rowIdx,
+								unsigned colIdx
+								) const
+{
+	return (*this)->isZero(rowIdx, colIdx);
+}
+
+
 bool ExportVariable::isOne(	const ExportIndex& rowIdx,
 							const ExportIndex& colIdx
 							) const
@@ -210,6 +218,14 @@ bool ExportVariable::isOne(	const ExportIndex& rowIdx,
 }
 
 
+bool ExportVariable::isOne(	unsigned rowIdx,
+							unsigned colIdx
+							) const
+{
+	return (*this)->isOne(rowIdx, colIdx);
+}
+
+
 bool ExportVariable::isGiven(	const ExportIndex& rowIdx,
 								const ExportIndex& colIdx
 								) const
@@ -218,6 +234,14 @@ bool ExportVariable::isGiven(	const ExportIndex& rowIdx,
 }
 
 
+bool ExportVariable::isGiven(	unsigned rowIdx,
+								unsigned colIdx
+								) const
+{
+	return (*this)->isGiven(rowIdx, colIdx);
+}
+
+
 bool ExportVariable::isGiven( ) const
 {
 	return (*this)->isGiven();
@@ -231,6 +255,14 @@ const std::string ExportVariable::get(	const ExportIndex& rowIdx,
 	return (*this)->get(rowIdx, colIdx);
 }
 
+
+const std::string ExportVariable::get(	unsigned rowIdx,
+										unsigned colIdx
+										) const
+{
+	return (*this)->get(rowIdx, colIdx);
+}
+
 uint ExportVariable::getNumRows( ) const
 {
 	return (*this)->getNumRows();
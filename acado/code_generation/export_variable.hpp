@@ -236,6 +236,10 @@ class ExportVariable : public ExportArgument
 							const ExportIndex& colIdx
 							) const;
 
+		bool isZero(	unsigned rowIdx,
+						unsigned colIdx
+						) const;
+
 		/** Returns whether given component is set to one.
 		 *
 		 *	@param[in] rowIdx		Variable row index of the component.
@@ -248,6 +252,10 @@ class ExportVariable : public ExportArgument
 							const ExportIndex& colIdx
 							) const;
 
+		bool isOne(	unsigned rowIdx,
+					unsigned colIdx
+					) const;
+
 		/** Returns whether given component is set to a given value.
 		 *
 		 *	@param[in] rowIdx		Variable row index of the component.
@@ -260,6 +268,10 @@ class ExportVariable : public ExportArgument
 								const ExportIndex& colIdx
 								) const;
 
+		bool isGiven(	unsigned rowIdx,
+						unsigned colIdx
+						) const;
+
 		/** Returns whether all components of the variable are set to a given value.
 		 *
 		 *	\return true  iff all components of the variable are set to a given value, \n
@@ -280,6 +292,10 @@ class ExportVariable : public ExportArgument
 								const ExportIndex& colIdx
 								) const;
 
+		const std::string get(	unsigned rowIdx,
+								unsigned colIdx
+								) const;
+
 		/** Returns number of rows of the variable.
 		 *
 		 *	\return Number of rows of the variable
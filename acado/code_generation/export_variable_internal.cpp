@@ -95,6 +95,13 @@ bool ExportVariableInternal::isZero(	const ExportIndex& rowIdx,
 	return hasValue(rowIdx, colIdx, 0.0);
 }
 
+bool ExportVariableInternal::isZero(	unsigned rowIdx,
+										unsigned colIdx
+										) const
+{
+	return hasValue(rowIdx, colIdx, 0.0);
+}
+
 bool ExportVariableInternal::isOne(	const ExportIndex& rowIdx,
 									const ExportIndex& colIdx
 									) const
@@ -102,6 +109,13 @@ bool ExportVariableInternal::isOne(	const ExportIndex& rowIdx,
 	return hasValue(rowIdx, colIdx, 1.0);
 }
 
+bool ExportVariableInternal::isOne(	unsigned rowIdx,
+									unsigned colIdx
+									) const
+{
+	return hasValue(rowIdx, colIdx, 1.0);
+}
+
 
 bool ExportVariableInternal::isGiven(	const ExportIndex& rowIdx,
 										const ExportIndex& colIdx
@@ -113,6 +127,16 @@ bool ExportVariableInternal::isGiven(	const ExportIndex& rowIdx,
 	return true;
 }
 
+bool ExportVariableInternal::isGiven(	unsigned rowIdx,
+										unsigned colIdx
+										) const
+{
+	if (hasValue(rowIdx, colIdx, undefinedEntry) == true)
+		return false;
+
+	return true;
+}
+
 bool ExportVariableInternal::isGiven() const
 {
 	return ExportArgumentInternal::isGiven();
@@ -137,12 +161,7 @@ const std::string ExportVariableInternal::get(	const ExportIndex& rowIdx,
 	if ( ( totalIdx.isGiven() == true ) && ( rowIdx.isGiven() == true ) && ( colIdx.isGiven() == true ) )
 	{
 		if (isGiven(rowIdx, colIdx) == false)
-		{
-			if ( ( isCalledByValue() == true ) && ( totalIdx.getGivenValue() == 0 ) )
-				s << getFullName();
-			else
-				s << getFullName() << "[" << totalIdx.getGivenValue() << "]";
-		}
+			exportName(s, totalIdx.getGivenValue());
 		else
 		{
 			s << "(real_t)" << data->operator()(totalIdx.getGivenValue());
@@ -155,6 +174,32 @@ const std::string ExportVariableInternal::get(	const ExportIndex& rowIdx,
 }
 
 
+const std::string ExportVariableInternal::get(	unsigned rowIdx,
+												unsigned colIdx
+												) const
+{
+	stringstream s;
+	exportComponent(s, rowIdx, colIdx);
+
+	return s.str();
+}
+
+
+std::ostream& ExportVariableInternal::exportComponent(	std::ostream& stream,
+														unsigned rowIdx,
+														unsigned colIdx
+														) const
+{
+	unsigned totalIdx;
+
+	// Given values are formatted by get() in order to use the same precision
+	if (getGivenTotalIdx(rowIdx, colIdx, totalIdx) == false || isGiven(rowIdx, colIdx) == true)
+		return stream << get(ExportIndex( (int)rowIdx ), ExportIndex( (int)colIdx ));
+
+	return exportName(stream, totalIdx);
+}
+
+
 uint ExportVariableInternal::getNumRows( ) const
 {
 	if ( nRows > 0 )
@@ -430,6 +475,39 @@ ExportIndex	ExportVariableInternal::getTotalIdx(	const ExportIndex& _rowIdx,
 }
 
 
+bool ExportVariableInternal::getGivenTotalIdx(	unsigned rowIdx,
+												unsigned colIdx,
+												unsigned& totalIdx
+												) const
+{
+	if ( ( rowOffset.isGiven() == false ) || ( colOffset.isGiven() == false ) )
+		return false;
+
+	unsigned row = rowIdx + rowOffset.getGivenValue();
+	unsigned col = colIdx + colOffset.getGivenValue();
+
+	if ( doAccessTransposed == false )
+		totalIdx = row * getColDim() + col;
+	else
+		totalIdx = col * getColDim() + row;
+
+	return true;
+}
+
+
+std::ostream& ExportVariableInternal::exportName(	std::ostream& stream,
+													unsigned totalIdx
+													) const
+{
+	stream << getFullName();
+
+	if ( ( isCalledByValue() == false ) || ( totalIdx != 0 ) )
+		stream << "[" << totalIdx << "]";
+
+	return stream;
+}
+
+
 returnValue ExportVariableInternal::setSubmatrixOffsets(	const ExportIndex& _rowOffset,
 															const ExportIndex& _colOffset,
 															unsigned _rowDim,
@@ -476,6 +554,23 @@ bool ExportVariableInternal::hasValue(	const ExportIndex& rowIdx,
 	return false;
 }
 
+bool ExportVariableInternal::hasValue(	unsigned rowIdx,
+										unsigned colIdx,
+										double _value
+										) const
+{
+	if ((getType() == STATIC_CONST_INT || getType() == STATIC_CONST_REAL) &&
+			acadoIsEqual(_value, undefinedEntry) == true)
+		return true;
+
+	unsigned ind;
+
+	if (getGivenTotalIdx(rowIdx, colIdx, ind) == false)
+		return hasValue(ExportIndex( (int)rowIdx ), ExportIndex( (int)colIdx ), _value);
+
+	return acadoIsEqual(data->operator()( ind ), _value);
+}
+
 bool ExportVariableInternal::isSubMatrix() const
 {
 	if (nRows == 0 && nCols == 0)
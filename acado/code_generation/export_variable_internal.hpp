@@ -111,6 +111,10 @@ class ExportVariableInternal : public ExportArgumentInternal
 							const ExportIndex& colIdx
 							) const;
 
+		bool isZero(	unsigned rowIdx,
+						unsigned colIdx
+						) const;
+
 		/** Returns whether given component is set to one.
 		 *
 		 *	@param[in] rowIdx		Variable row index of the component.
@@ -123,6 +127,10 @@ class ExportVariableInternal : public ExportArgumentInternal
 							const ExportIndex& colIdx
 							) const;
 
+		bool isOne(	unsigned rowIdx,
+					unsigned colIdx
+					) const;
+
 		/** Returns whether given component is set to a given value.
 		 *
 		 *	@param[in] rowIdx		Variable row index of the component.
@@ -135,6 +143,10 @@ class ExportVariableInternal : public ExportArgumentInternal
 								const ExportIndex& colIdx
 								) const;
 
+		bool isGiven(	unsigned rowIdx,
+						unsigned colIdx
+						) const;
+
 		virtual bool isGiven() const;
 
 
@@ -150,6 +162,27 @@ class ExportVariableInternal : public ExportArgumentInternal
 							const ExportIndex& colIdx
 							) const;
 
+		const std::string get(	unsigned rowIdx,
+								unsigned colIdx
+								) const;
+
+		/** Writes the value or the address of a given component directly into
+		 *	a stream. The output is the same as of get(), but for components
+		 *	with integer indices into a variable with given offsets, neither
+		 *	index expressions nor temporary strings are built. This is meant
+		 *	for code export loops over all components of large matrices.
+		 *
+		 *	@param[in] stream		Stream to write to.
+		 *	@param[in] rowIdx		Row index of the component.
+		 *	@param[in] colIdx		Column index of the component.
+		 *
+		 *	\return Reference to the stream
+		 */
+		std::ostream& exportComponent(	std::ostream& stream,
+										unsigned rowIdx,
+										unsigned colIdx
+										) const;
+
 		/** Returns number of rows of the variable.
 		 *
 		 *	\return Number of rows of the variable
@@ -292,6 +325,35 @@ class ExportVariableInternal : public ExportArgumentInternal
 											const ExportIndex& colIdx
 											) const;
 
+		/** Computes total index of given component within memory without
+		 *	building index expressions, which is possible if the offsets of the
+		 *	variable are given.
+		 *
+		 *	@param[in]  rowIdx		Row index of the component.
+		 *	@param[in]  colIdx		Column index of the component.
+		 *	@param[out] totalIdx	Total index of given component.
+		 *
+		 *	\return true  iff total index could be computed, \n
+		 *	        false otherwise
+		 */
+		bool getGivenTotalIdx(	unsigned rowIdx,
+								unsigned colIdx,
+								unsigned& totalIdx
+								) const;
+
+		/** Writes the address of the component with given total index into a
+		 *	stream, i.e. the full name followed by the index (which is omitted
+		 *	for variables called by value at index 0).
+		 *
+		 *	@param[in] stream		Stream to write to.
+		 *	@param[in] totalIdx		Total index of the component.
+		 *
+		 *	\return Reference to the stream
+		 */
+		std::ostream& exportName(	std::ostream& stream,
+									unsigned totalIdx
+									) const;
+
 		/** Assigns offsets and dimensions of a sub-matrix. This function is used to
 		 *	access only a sub-matrix of the variable without copying its values to
 		 *	a new variable.
@@ -329,6 +391,11 @@ class ExportVariableInternal : public ExportArgumentInternal
 						double _value
 						) const;
 
+		bool hasValue(	unsigned _rowIdx,
+						unsigned _colIdx,
+						double _value
+						) const;
+
 	protected:
 
 		bool doAccessTransposed;				/**< Flag indicating whether variable is to be accessed in a transposed manner. */
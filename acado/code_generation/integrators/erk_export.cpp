@@ -33,6 +33,8 @@
 
 #include <acado/code_generation/integrators/erk_export.hpp>
 
+#include <iomanip>
+
 using namespace std;
 
 BEGIN_NAMESPACE_ACADO
@@ -46,6 +48,7 @@ ExplicitRungeKuttaExport::ExplicitRungeKuttaExport(	UserInteraction* _userIntera
 									) : RungeKuttaExport( _userInteraction,_commonHeaderName )
 {
 	is_symmetric = BT_FALSE;
+	batchWorkspaceSize = 0;
 }
 
 
@@ -53,6 +56,10 @@ ExplicitRungeKuttaExport::ExplicitRungeKuttaExport(	const ExplicitRungeKuttaExpo
 									) : RungeKuttaExport( arg )
 {
 	copy( arg );
+
+	integrateBatch = arg.integrateBatch;
+	batchWorkspaceSize = arg.batchWorkspaceSize;
+	sensitivityPattern = arg.sensitivityPattern;
 }
 
 
@@ -163,13 +170,33 @@ returnValue ExplicitRungeKuttaExport::setup( )
 		loop.addStatement( std::string("for(") + run.getName() + " = 0; " + run.getName() + " < " + numInt.getName() + "; " + run.getName() + "++ ) {\n" );
 	}
 
+	// structurally zero sensitivities are neither read nor updated by the stages
+	std::vector< std::pair< uint,uint > > columns = getPropagatedColumns( rhsDim );
+	bool isDense = ( columns.size() == 1 && columns[0].second == rhsDim );
+
 	for( uint run1 = 0; run1 < rkOrder; run1++ )
 	{
-		loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
+		if( isDense ) {
+			loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
+		}
+		else {
+			for( uint i = 0; i < columns.size(); i++ ) {
+				uint first = columns[i].first, last = columns[i].second;
+				loop.addStatement( rk_xxx.getCols( first,last ) == rk_eta.getCols( first,last ) + Ah.getRow(run1)*rk_kkk.getCols( first,last ) );
+			}
+		}
 		if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
 		loop.addFunctionCall( getNameDiffsRHS(),rk_xxx,rk_kkk.getAddress(run1,0) );
 	}
-	loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	if( isDense ) {
+		loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	}
+	else {
+		for( uint i = 0; i < columns.size(); i++ ) {
+			uint first = columns[i].first, last = columns[i].second;
+			loop.addStatement( rk_eta.getCols( first,last ) += b4h^rk_kkk.getCols( first,last ) );
+		}
+	}
 	loop.addStatement( rk_ttt += DMatrix(1.0/grid.getNumIntervals()) );
     // end of integrator loop
 
@@ -181,6 +208,16 @@ returnValue ExplicitRungeKuttaExport::setup( )
 	
 	integrate.addStatement( error_code == 0 );
 
+	// setup INTEGRATEBATCH function
+	int batchBlockSize;
+	get( CG_BATCH_INTEGRATOR_BLOCK_SIZE,batchBlockSize );
+	if ( batchBlockSize < 0 )
+		return ACADOERROR( RET_INVALID_OPTION );
+
+	batchWorkspaceSize = 0;
+	if ( batchBlockSize > 0 && equidistantControlGrid() )
+		setupBatchIntegration( batchBlockSize,rhsDim );
+
 	LOG( LVL_DEBUG ) << "done" << endl;
 
 	return SUCCESSFUL_RETURN;
@@ -208,6 +245,8 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 	z = AlgebraicState("", NXA, 1);
 	u = Control("", NU, 1);
 	od = OnlineData("", NOD, 1);
+
+	sensitivityPattern = BMatrix();
 	
 	if( NDX > 0 && NDX != NX ) {
 		return ACADOERROR( RET_INVALID_OPTION );
@@ -232,14 +271,17 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 		/*	if ( f.getDim() != f.getNX() )
 		return ACADOERROR( RET_ILLFORMED_ODE );*/
 
+		// structurally zero sensitivities stay zero during the whole integration
+		setupSensitivityPattern( rhs_ );
+
 		// add VDE for differential states
-		f << multipleForwardDerivative( rhs_, x, Gx );
+		f << applySensitivityPattern( multipleForwardDerivative( rhs_, x, applySensitivityPattern( Gx,0 ) ),0 );
 		/*	if ( f.getDim() != f.getNX() )
 		return ACADOERROR( RET_ILLFORMED_ODE );*/
 
 
 		// add VDE for control inputs
-		f << multipleForwardDerivative( rhs_, x, Gu ) + forwardDerivative( rhs_, u );
+		f << applySensitivityPattern( multipleForwardDerivative( rhs_, x, applySensitivityPattern( Gu,NX ) ) + forwardDerivative( rhs_, u ),NX );
 		// 	if ( f.getDim() != f.getNX() )
 		// 		return ACADOERROR( RET_ILLFORMED_ODE );
 
@@ -250,7 +292,7 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 	else if( (ExportSensitivityType)sensGen != NO_SENSITIVITY ) {
 		return ACADOERROR( RET_INVALID_OPTION );
 	}
-	if( f.getNT() > 0 ) timeDependant = true;
+	if( f.getNT() > 0 || f_ODE.getNT() > 0 ) timeDependant = true;
 
 	int matlabInterface;
 	userInteraction->get(GENERATE_MATLAB_INTERFACE, matlabInterface);
@@ -308,6 +350,8 @@ returnValue ExplicitRungeKuttaExport::getFunctionDeclarations(	ExportStatementBl
 														) const
 {
 	declarations.addDeclaration( integrate );
+	if ( batchWorkspaceSize > 0 )
+		declarations.addDeclaration( integrateBatch );
 
 	int matlabInterface;
 	userInteraction->get( GENERATE_MATLAB_INTERFACE, matlabInterface );
@@ -352,6 +396,8 @@ returnValue ExplicitRungeKuttaExport::getCode(	ExportStatementBlock& code
 	double h = (grid.getLastTime() - grid.getFirstTime())/grid.getNumIntervals();
 	code.addComment(std::string("Fixed step size:") + toString(h));
 	code.addFunction( integrate );
+	if ( batchWorkspaceSize > 0 )
+		code.addFunction( integrateBatch );
 
 
 // 	if ( (PrintLevel)printLevel >= HIGH ) 
@@ -386,6 +432,12 @@ returnValue ExplicitRungeKuttaExport::setupOutput(  const std::vector<Grid> outp
 }
 
 
+uint ExplicitRungeKuttaExport::getBatchWorkspaceSize( ) const
+{
+	return batchWorkspaceSize;
+}
+
+
 ExportVariable ExplicitRungeKuttaExport::getAuxVariable() const
 {
 	ExportVariable max;
@@ -401,6 +453,220 @@ ExportVariable ExplicitRungeKuttaExport::getAuxVariable() const
 // PROTECTED:
 
 
+/** Returns the index of the stage vector of a trajectory of the current block
+ *	within the workspace of the batch integrator. */
+static std::string batchStageOffset( uint stage )
+{
+	if( stage == 0 )
+		return "lane";
+
+	return std::string( "(" ) + toString( stage ) + " * nLanes + lane)";
+}
+
+
+returnValue ExplicitRungeKuttaExport::setupBatchIntegration(	uint blockSize,
+																uint rhsDim
+																)
+{
+	const uint rkOrder = getNumStages();
+	const uint numInts = grid.getNumIntervals();
+	const uint xxxDim  = timeDependant ? inputDim+1 : inputDim;
+	const bool DERIVATIVES = ( rhsDim > NX );
+
+	double h = (grid.getLastTime() - grid.getFirstTime())/numInts;
+	DMatrix Ah( DMatrix( AA )*=h );
+	DVector bh( DVector( bb )*=h );
+
+	batchWorkspaceSize = xxxDim + rkOrder*rhsDim;
+
+	ExportVariable rk_etaBatch( "rk_etaBatch", 1, inputDim );
+	ExportVariable rk_nBatch( "nBatch", 1, 1, INT, ACADO_LOCAL, true );
+	ExportVariable rk_workBatch( "rk_workBatch", 1, batchWorkspaceSize );
+
+	integrateBatch = ExportFunction( "integrateBatch", rk_etaBatch, rk_nBatch, rk_workBatch, reset_int );
+	integrateBatch.setReturnValue( error_code );
+	rk_etaBatch.setDoc( std::string( "Inputs and results of all trajectories, stored consecutively as for integrate() (" ) + toString( inputDim ) + " entries each)." );
+	rk_nBatch.setDoc( "Number of trajectories." );
+	rk_workBatch.setDoc( std::string( "Workspace provided by the caller (" ) + toString( batchWorkspaceSize ) + " entries per trajectory)." );
+	integrateBatch.doc( "Performs the integration and sensitivity propagation for one shooting interval of a batch of independent trajectories." );
+
+	// all trajectories of a block pass through each stage before the next one is started;
+	// the linear combinations of the stages are plain loops that can be vectorized
+	std::stringstream s;
+	s << scientific << setprecision( 16 );
+
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+
+	s << "int block;\n";
+	if ( useOMP )
+		s << "#pragma omp parallel for\n";
+	s << "for (block = 0; block < nBatch; block += " << blockSize << ")\n{\n";
+	s << "int run1, lane, i;\n";
+	s << "int nLanes = (nBatch - block < " << blockSize << ") ? nBatch - block : " << blockSize << ";\n";
+	s << "real_t ttt = " << grid.getFirstTime() << ";\n";
+	s << "real_t* const eta = rk_etaBatch + block * " << inputDim << ";\n";
+	s << "real_t* const xxx = rk_workBatch + block * " << batchWorkspaceSize << ";\n";
+	s << "real_t* const kkk = xxx + nLanes * " << xxxDim << ";\n\n";
+
+	s << "for (lane = 0; lane < nLanes; ++lane)\n{\n";
+	if( DERIVATIVES ) {
+		// initialize sensitivities:
+		s << "for (i = " << NX << "; i < " << rhsDim << "; ++i)\n"
+		  << "eta[lane * " << inputDim << " + i] = 0.0;\n";
+		s << "for (i = 0; i < " << NX << "; ++i)\n"
+		  << "eta[lane * " << inputDim << " + " << NX << " + i * " << NX+1 << "] = 1.0;\n";
+	}
+	if( inputDim > rhsDim ) {
+		s << "for (i = " << rhsDim << "; i < " << inputDim << "; ++i)\n"
+		  << "xxx[lane * " << xxxDim << " + i] = eta[lane * " << inputDim << " + i];\n";
+	}
+	s << "}\n\n";
+
+	s << "for (run1 = 0; run1 < " << numInts << "; ++run1)\n{\n";
+	for( uint run2 = 0; run2 < rkOrder; run2++ )
+	{
+		s << "for (lane = 0; lane < nLanes; ++lane)\n"
+		  << "for (i = 0; i < " << rhsDim << "; ++i)\n"
+		  << "xxx[lane * " << xxxDim << " + i] =";
+		for( uint run3 = 0; run3 < run2; run3++ )
+			if( acadoIsZero( Ah(run2,run3) ) == BT_FALSE )
+				s << " + (real_t)" << Ah(run2,run3) << "*kkk[" << batchStageOffset( run3 ) << " * " << rhsDim << " + i]";
+		s << " + eta[lane * " << inputDim << " + i];\n";
+
+		if( timeDependant )
+			s << "for (lane = 0; lane < nLanes; ++lane)\n"
+			  << "xxx[lane * " << xxxDim << " + " << inputDim << "] = ttt + " << ((double)cc(run2))/numInts << ";\n";
+
+		s << "for (lane = 0; lane < nLanes; ++lane)\n"
+		  << getNameDiffsRHS() << "( xxx + lane * " << xxxDim << ", kkk + " << batchStageOffset( run2 ) << " * " << rhsDim << " );\n";
+	}
+	s << "for (lane = 0; lane < nLanes; ++lane)\n"
+	  << "for (i = 0; i < " << rhsDim << "; ++i)\n"
+	  << "eta[lane * " << inputDim << " + i] +=";
+	for( uint run3 = 0; run3 < rkOrder; run3++ )
+		if( acadoIsZero( bh(run3) ) == BT_FALSE )
+			s << " + (real_t)" << bh(run3) << "*kkk[" << batchStageOffset( run3 ) << " * " << rhsDim << " + i]";
+	s << ";\n";
+	s << "ttt += " << 1.0/numInts << ";\n";
+	s << "}\n}\n";
+
+	integrateBatch.addStatement( s.str() );
+	integrateBatch.addStatement( error_code == 0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExplicitRungeKuttaExport::setupSensitivityPattern( const Expression& rhs_ )
+{
+	Function fcn;
+	fcn << rhs_;
+
+	BMatrix dependency;
+	ACADO_TRY( fcn.getDependencyPattern( dependency ) );
+
+	// columns of the dependency pattern that belong to the states and controls
+	std::vector< int > column( NX+NU,-1 );
+	for( uint j = 0; j < NX+NU; j++ ) {
+		int k = j < NX ? fcn.index( VT_DIFFERENTIAL_STATE,j ) : fcn.index( VT_CONTROL,j-NX );
+		if( k >= 0 && k < (int)dependency.getNumCols()-1 )
+			column[j] = k;
+	}
+
+	sensitivityPattern.init( NX,NX+NU );
+	sensitivityPattern.setAll( false );
+
+	// mark all states that are reachable from the seed of each sensitivity
+	// direction in the dependency graph of the right-hand side
+	std::vector< uint > pending;
+	for( uint j = 0; j < NX+NU; j++ ) {
+		for( uint i = 0; i < NX; i++ ) {
+			if( j < NX ? i == j : ( column[j] >= 0 && dependency( i,column[j] ) == true ) ) {
+				sensitivityPattern( i,j ) = true;
+				pending.push_back( i );
+			}
+		}
+		while( !pending.empty() ) {
+			uint k = pending.back();
+			pending.pop_back();
+			if( column[k] < 0 )
+				continue;
+			for( uint i = 0; i < NX; i++ ) {
+				if( sensitivityPattern( i,j ) == false && dependency( i,column[k] ) == true ) {
+					sensitivityPattern( i,j ) = true;
+					pending.push_back( i );
+				}
+			}
+		}
+	}
+
+	// dense sensitivities are propagated as a whole
+	for( uint i = 0; i < NX; i++ )
+		for( uint j = 0; j < NX+NU; j++ )
+			if( sensitivityPattern( i,j ) == false )
+				return SUCCESSFUL_RETURN;
+
+	sensitivityPattern = BMatrix();
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+Expression ExplicitRungeKuttaExport::applySensitivityPattern(	const Expression& arg,
+																uint colOffset
+																) const
+{
+	if( sensitivityPattern.isEmpty() == true )
+		return arg;
+
+	Expression tmp;
+	for( uint i = 0; i < arg.getNumRows(); i++ ) {
+		Expression row;
+		for( uint j = 0; j < arg.getNumCols(); j++ ) {
+			if( sensitivityPattern( i,colOffset+j ) == true )
+				row.appendCols( arg( i,j ) );
+			else
+				row.appendCols( Expression( 1u ) );	// zero constant
+		}
+		tmp.appendRows( row );
+	}
+
+	return tmp;
+}
+
+
+std::vector< std::pair< uint,uint > > ExplicitRungeKuttaExport::getPropagatedColumns( uint rhsDim ) const
+{
+	std::vector< std::pair< uint,uint > > columns;
+
+	if( sensitivityPattern.isEmpty() == true || rhsDim != NX*(1+NX+NU) ) {
+		columns.push_back( std::make_pair( 0u,rhsDim ) );
+		return columns;
+	}
+
+	// states, followed by the row-wise sensitivities w.r.t. states and controls
+	std::vector< bool > isPropagated( rhsDim,true );
+	for( uint i = 0; i < NX; i++ ) {
+		for( uint j = 0; j < NX; j++ )
+			isPropagated[ NX+i*NX+j ] = sensitivityPattern( i,j );
+		for( uint j = 0; j < NU; j++ )
+			isPropagated[ NX*(1+NX)+i*NU+j ] = sensitivityPattern( i,NX+j );
+	}
+
+	for( uint first = 0; first < rhsDim; ) {
+		uint last = first;
+		while( last < rhsDim && isPropagated[ last ] == isPropagated[ first ] )
+			last++;
+		if( isPropagated[ first ] == true )
+			columns.push_back( std::make_pair( first,last ) );
+		first = last;
+	}
+
+	return columns;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -154,6 +154,14 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		 */
 		virtual returnValue getCode(	ExportStatementBlock& code
 										);
+
+
+		/** Returns the number of workspace entries per trajectory that are needed by
+		 *	the exported batch integrator integrateBatch().
+		 *
+		 *	\return Workspace size per trajectory (0 if no batch integrator is exported)
+		 */
+		uint getBatchWorkspaceSize( ) const;
 							
         
         /** Sets up the output with the grids for the different output functions.									\n
@@ -209,8 +217,64 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		ExportVariable getAuxVariable() const;
 
 
+		/** Sets up the function integrateBatch(), which integrates a batch of independent
+		 *	trajectories in blocks of given size. All trajectories of a block advance through
+		 *	the Runge-Kutta stages together, each with its own part of a caller-supplied
+		 *	workspace; different blocks may be integrated in parallel using OpenMP.
+		 *
+		 *	@param[in] blockSize	Number of trajectories integrated in lockstep.
+		 *	@param[in] rhsDim		Number of integrated states and sensitivities.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setupBatchIntegration(	uint blockSize,
+											uint rhsDim
+											);
+
+
+		/** Sets up the sparsity pattern of the forward sensitivities. A sensitivity
+		 *	w.r.t. a state or control is structurally nonzero in all states that depend
+		 *	on it, directly or via other states, according to the dependency pattern
+		 *	of the right-hand side.
+		 *
+		 *	@param[in] rhs_			Right-hand side of the ODE.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setupSensitivityPattern(	const Expression& rhs_
+												);
+
+
+		/** Returns given sensitivities, in which all structurally zero entries are
+		 *	replaced by zero constants.
+		 *
+		 *	@param[in] arg			Sensitivities w.r.t. the states (NX x NX) or controls (NX x NU).
+		 *	@param[in] colOffset	Column offset within the sensitivity pattern (0 for states, NX for controls).
+		 *
+		 *	\return Sensitivities with structurally zero entries
+		 */
+		Expression applySensitivityPattern(	const Expression& arg,
+											uint colOffset
+											) const;
+
+
+		/** Returns the column ranges of the integrated states and sensitivities that
+		 *	are propagated, i.e. that are not structurally zero.
+		 *
+		 *	@param[in] rhsDim		Number of integrated states and sensitivities.
+		 *
+		 *	\return Ranges of propagated columns, given as first and one-past-last column
+		 */
+		std::vector< std::pair< uint,uint > > getPropagatedColumns(	uint rhsDim
+																	) const;
+
+
     protected:
 
+		ExportFunction integrateBatch;		/**< Function that integrates a batch of independent trajectories. */
+		uint batchWorkspaceSize;			/**< Workspace entries per trajectory needed by integrateBatch (0 if it is not exported). */
+
+		BMatrix sensitivityPattern;			/**< Structurally nonzero sensitivities w.r.t. states and controls (NX x (NX+NU)); empty if all are propagated. */
 
 };
 
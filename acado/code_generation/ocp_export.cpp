@@ -102,36 +102,28 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	//
-	// Export integrator
+	// Export integrator and solver
 	//
-	if (integrator != 0)
-	{
-		ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
-				commonHeaderName, _realString, _intString, _precision);
+	if (integrator == 0 || solver == 0)
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-		integrator->getCode( integratorFile );
+	ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
+			commonHeaderName, _realString, _intString, _precision);
 
-		if (integratorFile.exportCode( ) != SUCCESSFUL_RETURN)
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
+	integrator->getCode( integratorFile );
 
-	//
-	// Export solver
-	//
-	if( solver != 0 )
-	{
-		ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
-				commonHeaderName, _realString, _intString, _precision);
+	ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
+			commonHeaderName, _realString, _intString, _precision);
 
-		solver->getCode( solverFile );
+	solver->getCode( solverFile );
 
-		if ( solverFile.exportCode( ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
+	// Both files are set up completely, such that they can be written concurrently
+	std::vector< const ExportFile* > files;
+	files.push_back( &integratorFile );
+	files.push_back( &solverFile );
+
+	if (exportFiles( files ) != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	LOG( LVL_DEBUG ) << "Export templates" << endl;
 
@@ -320,7 +312,11 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 				dirName + string("/") + moduleName + "_hessian_regularization.c",
 				moduleName
 		);
-		evd.configure( ocp.getNX()+ocp.getNU(), 1e-12 );
+		int hessianRegularization;
+		get( CG_HESSIAN_REGULARIZATION, hessianRegularization );
+
+		evd.configure(	ocp.getNX()+ocp.getNU(), 1e-12,
+						(HessianRegularizationMode)hessianRegularization, ocp.getN() );
 		if ( evd.exportCode() != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 	}
@@ -617,6 +613,8 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 	get(CG_USE_ARRIVAL_COST, useAC);
 	int covCalc;
 	get(CG_COMPUTE_COVARIANCE_MATRIX, covCalc);
+	int useTimingCounters;
+	get(CG_USE_TIMING_COUNTERS, useTimingCounters);
 
 	int linSolver;
 	get(LINEAR_ALGEBRA_SOLVER, linSolver);
@@ -658,6 +656,10 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 			make_pair(toString( useAC ), "Providing interface for arrival cost.");
 	options[ "ACADO_COMPUTE_COVARIANCE_MATRIX" ] =
 			make_pair(toString( covCalc ), "Compute covariance matrix of the last state estimate.");
+	options[ "ACADO_USE_TIMING_COUNTERS" ] =
+			make_pair(toString( useTimingCounters ), "Instrument the solver phases with timing counters.");
+	options[ "ACADO_USE_WORKER_POOL" ] =
+			make_pair(toString( solver->usesWorkerPool() == true ? 1 : 0 ), "Simulate the shooting nodes on persistent worker threads.");
 	options[ "ACADO_QP_NV" ] =
 			make_pair(toString( solver->getNumQPvars() ), "Total number of QP optimization variables.");
 
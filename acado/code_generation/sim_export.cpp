@@ -290,6 +290,11 @@ returnValue SIMexport::setup( )
 	}
 
 	if( !integrator->equidistantControlGrid() ) return ACADOERROR( RET_INVALID_OPTION );
+
+	int batchBlockSize;
+	get( CG_BATCH_INTEGRATOR_BLOCK_SIZE, batchBlockSize );
+	if( batchBlockSize > 0 && getBatchWorkspaceSize() == 0 )
+		return ACADOERRORTEXT( RET_INVALID_OPTION, "The batch integrator requires an explicit Runge-Kutta method with forward or no sensitivities." );
 	
 	setStatus( BS_READY );
 
@@ -804,6 +809,10 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 	options[ "ACADO_NOD" ]  = make_pair(toString( getNOD() ),  "Number of online data values.");
 	options[ "ACADO_NUMOUT" ]  = make_pair(toString( nOutV.getDim() ),  "Number of output functions.");
 
+	uint batchWorkspaceSize = getBatchWorkspaceSize();
+	if( batchWorkspaceSize > 0 )
+		options[ "ACADO_BATCH_WORKSPACE_SIZE" ]  = make_pair(toString( batchWorkspaceSize ),  "Number of workspace entries per trajectory needed by integrateBatch().");
+
 	if( !nMeasV.isEmpty() && !nOutV.isEmpty() ) {
 		std::ostringstream acado_nout;
 		ExportVariable( "ACADO_NOUT",nOutV,STATIC_CONST_INT ).exportDataDeclaration(acado_nout);
@@ -898,6 +907,28 @@ returnValue SIMexport::executeTest( const std::string& _dirName ) {
 	return SUCCESSFUL_RETURN;
 }
 
+uint SIMexport::getBatchWorkspaceSize( ) const
+{
+	if( integrator == 0 )
+		return 0;
+
+	int integratorType;
+	get( INTEGRATOR_TYPE, integratorType );
+
+	// Note: Only the explicit Runge-Kutta methods export a batch integrator.
+	switch( (ExportIntegratorType)integratorType )
+	{
+		case INT_EX_EULER:
+		case INT_RK2:
+		case INT_RK3:
+		case INT_RK4:
+			return static_cast<ExplicitRungeKuttaExport*>(integrator)->getBatchWorkspaceSize();
+
+		default:
+			return 0;
+	}
+}
+
 returnValue SIMexport::setTimingCalls( uint _timingCalls ) {
 	timingCalls = _timingCalls;
 
@@ -316,6 +316,13 @@ class SIMexport : public ExportModule, public ModelContainer
         virtual returnValue setTimingCalls( uint _timingCalls
         									);
 
+		/** Returns the number of workspace entries per trajectory that are needed
+		 *	by the exported batch integrator.
+		 *
+		 *	\return Workspace size per trajectory (0 if no batch integrator is exported)
+		 */
+		uint getBatchWorkspaceSize( ) const;
+
     protected:
 
         uint timingCalls;						/**< The number of calls to the exported function for the timing results. */
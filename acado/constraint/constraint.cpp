@@ -302,8 +302,9 @@ returnValue Constraint::add( const ConstraintComponent& component ){
 
         VariablesGrid LBgrid = component.getLBgrid();
 
+        uint hint = 0;
         for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
-            DVector tmp = LBgrid.linearInterpolation( grid.getTime(run1) );
+            DVector tmp = LBgrid.linearInterpolation( grid.getTime(run1),hint );
             tmp_lb(run1) = tmp(0);
         }
     }
@@ -324,8 +325,9 @@ returnValue Constraint::add( const ConstraintComponent& component ){
 
         VariablesGrid UBgrid = component.getUBgrid();
 
+        uint hint = 0;
         for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
-            DVector tmp = UBgrid.linearInterpolation( grid.getTime(run1) );
+            DVector tmp = UBgrid.linearInterpolation( grid.getTime(run1),hint );
             tmp_ub(run1) = tmp(0);
         }
     }
@@ -362,8 +364,9 @@ returnValue Constraint::add( const int index_, const ConstraintComponent& compon
 
         VariablesGrid LBgrid = component.getLBgrid();
 
+        uint hint = 0;
         for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
-            DVector tmp = LBgrid.linearInterpolation( grid.getTime(run1) );
+            DVector tmp = LBgrid.linearInterpolation( grid.getTime(run1),hint );
             tmp_lb(run1) = tmp(0);
         }
     }
@@ -384,8 +387,9 @@ returnValue Constraint::add( const int index_, const ConstraintComponent& compon
 
         VariablesGrid UBgrid = component.getUBgrid();
 
+        uint hint = 0;
         for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
-            DVector tmp = UBgrid.linearInterpolation( grid.getTime(run1) );
+            DVector tmp = UBgrid.linearInterpolation( grid.getTime(run1),hint );
             tmp_ub(run1) = tmp(0);
         }
     }
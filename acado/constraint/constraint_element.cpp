@@ -241,6 +241,11 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
     dForward  = rhs.dForward ;
     dBackward = rhs.dBackward;
 
+    columnCompression       = rhs.columnCompression;
+    rowCompression          = rhs.rowCompression;
+    nonlinearRowCompression = rhs.nonlinearRowCompression;
+    constantJacobian        = rhs.constantJacobian;
+
     condType  = rhs.condType;
 }
 
@@ -469,6 +474,11 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         dForward  = rhs.dForward ;
         dBackward = rhs.dBackward;
 
+        columnCompression       = rhs.columnCompression;
+        rowCompression          = rhs.rowCompression;
+        nonlinearRowCompression = rhs.nonlinearRowCompression;
+        constantJacobian        = rhs.constantJacobian;
+
         condType  = rhs.condType;
     }
 
@@ -523,7 +533,7 @@ returnValue ConstraintElement::init(  const OCPiterate& iter ){
         t_index[run2] = fcn[run2].index( VT_TIME, 0 );
     }
 
-    return SUCCESSFUL_RETURN;
+    return setupJacobianCompression( );
 }
 
 
@@ -750,6 +760,145 @@ returnValue ConstraintElement::initializeEvaluationPoints( const OCPiterate& ite
 	return SUCCESSFUL_RETURN;
 }
 
+
+returnValue ConstraintElement::setupJacobianCompression( ){
+
+    int run1, run2, run3;
+
+    if( (int) rowCompression.size() == nFcn ){
+
+        for( run1 = 0; run1 < nFcn; run1++ )
+            if( (int) columnCompression[run1].getNumRows() != fcn[run1].getDim() ||
+                (int) columnCompression[run1].getNumCols() != ny )
+                break;
+
+        if( run1 == nFcn )
+            return SUCCESSFUL_RETURN;
+    }
+
+    columnCompression      .resize( nFcn );
+    rowCompression         .resize( nFcn );
+    nonlinearRowCompression.resize( nFcn );
+    constantJacobian       .assign( nFcn, DMatrix() );
+
+    for( run1 = 0; run1 < nFcn; run1++ ){
+
+        const int nc = fcn[run1].getDim();
+
+        BMatrix pattern( nc, ny );
+        pattern.setAll( true );
+
+        // C-functions are treated as dense:
+        if( fcn[run1].isSymbolic() == BT_TRUE ){
+
+            BMatrix full;
+            ACADO_TRY( fcn[run1].getDependencyPattern( full ) );
+
+            for( run3 = 0; run3 < ny; run3++ ){
+
+                int k = y_index[run1][run3];
+
+                for( run2 = 0; run2 < nc; run2++ ){
+                    if( k >= 0 && k < (int) full.getNumCols()-1 )
+                        pattern( run2, run3 ) = full( run2, k );
+                    else
+                        pattern( run2, run3 ) = false;
+                }
+            }
+        }
+
+        columnCompression[run1].init( pattern );
+        rowCompression   [run1].init( pattern.transpose() );
+
+        // rows of affine components are excluded from later sweeps:
+        BMatrix nonlinearPattern( pattern );
+
+        for( run2 = 0; run2 < nc; run2++ )
+            if( fcn[run1].isAffine( run2 ) == BT_TRUE )
+                for( run3 = 0; run3 < ny; run3++ )
+                    nonlinearPattern( run2, run3 ) = false;
+
+        nonlinearRowCompression[run1].init( nonlinearPattern.transpose() );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ConstraintElement::computeCompressedBackwardSensitivities( int idx, int number,
+                                                                      DMatrix &Dx, DMatrix &Dxa, DMatrix &Dp,
+                                                                      DMatrix &Du, DMatrix &Dw ){
+
+    int run1, run2;
+
+    const int nc      = fcn[idx].getDim();
+
+    // affine components have been differentiated before:
+    const bool isCached = ( (int) constantJacobian[idx].getNumRows() == nc ) && ( nc > 0 );
+
+    const JacobianCompression& rows = ( isCached == true ) ? nonlinearRowCompression[idx] : rowCompression[idx];
+    const int nVars   = fcn[idx].getNumberOfVariables()+1;
+    const int nColors = rows.getNumColors();
+
+    DMatrix D( nc, ny );
+    D.setZero();
+
+    if( nColors > 0 ){
+
+        // ONE VECTOR-MODE BACKWARD SWEEP, ONE DIRECTION PER COLOR:
+        // ---------------------------------------------------------
+        double *seed = new double[nc   *nColors];
+        double *G    = new double[nVars*nColors];
+
+        for( run1 = 0; run1 < nc*nColors; run1++ )
+            seed[run1] = 0.0;
+        for( run1 = 0; run1 < nVars*nColors; run1++ )
+            G[run1] = 0.0;
+
+        for( run1 = 0; run1 < nc; run1++ )
+            if( rows.getColor( run1 ) >= 0 )
+                seed[run1*nColors+rows.getColor( run1 )] = 1.0;
+
+        returnValue returnvalue = fcn[idx].AD_backward( number, nColors, seed, G );
+
+        if( returnvalue == SUCCESSFUL_RETURN ){
+            for( run1 = 0; run1 < nc; run1++ )
+                for( run2 = 0; run2 < ny; run2++ )
+                    if( rows.isNonzero( run2, run1 ) == true )
+                        D( run1, run2 ) = G[y_index[idx][run2]*nColors+rows.getColor( run1 )];
+        }
+
+        delete[] seed;
+        delete[] G;
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            return ACADOERROR( returnvalue );
+    }
+
+    // rows that are nonzero but not colored any more belong to affine components:
+    bool hasAffineRows = false;
+
+    for( run1 = 0; run1 < nc; run1++ ){
+        if( ( nonlinearRowCompression[idx].getColor( run1 ) < 0 ) && ( rowCompression[idx].getColor( run1 ) >= 0 ) ){
+            hasAffineRows = true;
+            if( isCached == true )
+                D.row( run1 ) = constantJacobian[idx].row( run1 );
+        }
+    }
+
+    if( ( isCached == false ) && ( hasAffineRows == true ) )
+        constantJacobian[idx] = D;
+
+    Dx  = D.block( 0,           0, nc, nx );
+    Dxa = D.block( 0,          nx, nc, na );
+    Dp  = D.block( 0,       nx+na, nc, np );
+    Du  = D.block( 0,    nx+na+np, nc, nu );
+    Dw  = D.block( 0, nx+na+np+nu, nc, nw );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ConstraintElement::get(Function& function_, DMatrix& lb_, DMatrix& ub_)
 {
 	if ( fcn == NULL )
@@ -233,6 +233,31 @@ class ConstraintElement{
 														);
 
 
+		/** Colors the columns (w.r.t. the stacked variables y = (x,xa,p,u,w)) and
+		 *  the rows of the constraint Jacobians based on their sparsity patterns
+		 *  and detects affine components, whose Jacobian rows are constant.
+		 *  The colorings are only recomputed if the dimensions have changed.     \n
+		 *                                                                        \n
+		 *  \return SUCCESSFUL_RETURN                                             \n
+		 */
+		returnValue setupJacobianCompression( );
+
+		/** Computes the full Jacobian of the function with given index w.r.t.
+		 *  x, xa, p, u and w by one vector-mode backward sweep with one
+		 *  direction per row color. The rows of affine components are only
+		 *  differentiated once and taken from constantJacobian afterwards.       \n
+		 *                                                                        \n
+		 *  \return SUCCESSFUL_RETURN                                             \n
+		 */
+		returnValue computeCompressedBackwardSensitivities(	int idx,       /**< index of the function     */
+															int number,    /**< number of the sweep       */
+															DMatrix &Dx,   /**< Jacobian w.r.t. x         */
+															DMatrix &Dxa,  /**< Jacobian w.r.t. xa        */
+															DMatrix &Dp,   /**< Jacobian w.r.t. p         */
+															DMatrix &Du,   /**< Jacobian w.r.t. u         */
+															DMatrix &Dw    /**< Jacobian w.r.t. w         */ );
+
+
 
     //
     // DATA MEMBERS:
@@ -258,6 +283,13 @@ class ConstraintElement{
         int            **y_index;   /**< index lists             */
         int             *t_index;   /**< time indices            */
 
+        std::vector< JacobianCompression > columnCompression;   /**< colored columns of the Jacobians (w.r.t. y) */
+        std::vector< JacobianCompression > rowCompression;      /**< colored rows of the Jacobians               */
+        std::vector< JacobianCompression > nonlinearRowCompression; /**< colored rows of the non-affine components */
+        std::vector< DMatrix >             constantJacobian;    /**< Jacobians (w.r.t. y) whose rows of affine
+                                                                 *   components are constant (empty if not yet
+                                                                 *   evaluated or if there are no such rows)   */
+
 
         // DIMENSIONS:
         // ----------------------
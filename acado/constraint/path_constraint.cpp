@@ -148,19 +148,26 @@ returnValue PathConstraint::evaluateSensitivities(){
             DMatrix Du ( nBDirs, nu );
             DMatrix Dw ( nBDirs, nw );
 
-			for( run1 = 0; run1 < nBDirs; run1++ )
+			// unit seeds: one sweep per group of structurally orthogonal rows
+			if( ( bSeed->isIdentity( 0, run3 ) == BT_TRUE ) && ( nBDirs == fcn[0].getDim() ) )
 			{
-				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-				
-				JJ[0].setZero( );
-
-            }
+				ACADO_TRY( computeCompressedBackwardSensitivities( 0, run3, Dx, Dxa, Dp, Du, Dw ) );
+			}
+			else
+			{
+				for( run1 = 0; run1 < nBDirs; run1++ )
+				{
+					ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
+
+					if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
+					if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
+					if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
+					if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
+					if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
+
+					JJ[0].setZero( );
+				}
+			}
 
 			if( nx > 0 )
 				dBackward.setDense( run3,     run3, Dx );
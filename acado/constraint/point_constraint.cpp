@@ -257,17 +257,25 @@ returnValue PointConstraint::evaluateSensitivities( ){
         DMatrix Du ( nBDirs, nu );
         DMatrix Dw ( nBDirs, nw );
 
-        for( run1 = 0; run1 < nBDirs; run1++ )
+		// unit seeds: one sweep per group of structurally orthogonal rows
+		if( ( bSeed->isIdentity( 0, 0 ) == BT_TRUE ) && ( nBDirs == fcn[0].getDim() ) )
 		{
-			ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1), JJ[0] ) );
-	
-			if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-			if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-			if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-			if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-			if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-			
-			JJ[0].setZero( );
+			ACADO_TRY( computeCompressedBackwardSensitivities( 0, 0, Dx, Dxa, Dp, Du, Dw ) );
+		}
+		else
+		{
+			for( run1 = 0; run1 < nBDirs; run1++ )
+			{
+				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1), JJ[0] ) );
+
+				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
+				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
+				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
+				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
+				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
+
+				JJ[0].setZero( );
+			}
 		}
 
 		if( nx > 0 )
@@ -299,31 +307,31 @@ returnValue PointConstraint::evaluateSensitivities( ){
         if( xSeed != 0 ){
             DMatrix tmp;
             xSeed->getSubBlock(0,0,tmp);
-            returnvalue = computeForwardSensitivityBlock( 0, 0, &tmp );
+            returnvalue = computeForwardSensitivityBlock( 0, 0, &tmp, xSeed->isIdentity(0,0) );
             if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
         }
         if( xaSeed != 0 ){
             DMatrix tmp;
             xaSeed->getSubBlock(0,0,tmp);
-            returnvalue = computeForwardSensitivityBlock( nx, N+point_index, &tmp );
+            returnvalue = computeForwardSensitivityBlock( nx, N+point_index, &tmp, xaSeed->isIdentity(0,0) );
             if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
         }
         if( pSeed != 0 ){
             DMatrix tmp;
             pSeed->getSubBlock(0,0,tmp);
-            returnvalue = computeForwardSensitivityBlock( nx+na, 2*N+point_index, &tmp );
+            returnvalue = computeForwardSensitivityBlock( nx+na, 2*N+point_index, &tmp, pSeed->isIdentity(0,0) );
             if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
         }
         if( uSeed != 0 ){
             DMatrix tmp;
             uSeed->getSubBlock(0,0,tmp);
-            returnvalue = computeForwardSensitivityBlock( nx+na+np, 3*N+point_index, &tmp );
+            returnvalue = computeForwardSensitivityBlock( nx+na+np, 3*N+point_index, &tmp, uSeed->isIdentity(0,0) );
             if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
         }
         if( wSeed != 0 ){
             DMatrix tmp;
             wSeed->getSubBlock(0,0,tmp);
-            returnvalue = computeForwardSensitivityBlock( nx+na+np+nu, 4*N+point_index, &tmp );
+            returnvalue = computeForwardSensitivityBlock( nx+na+np+nu, 4*N+point_index, &tmp, wSeed->isIdentity(0,0) );
             if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
         }
 
@@ -674,36 +682,76 @@ returnValue PointConstraint::getBounds( const OCPiterate& iter ){
 // PROTECTED MEMBER FUNCTIONS:
 //
 
-inline returnValue PointConstraint::computeForwardSensitivityBlock( int offset, int offset2, DMatrix *seed ){
+inline returnValue PointConstraint::computeForwardSensitivityBlock( int offset, int offset2, DMatrix *seed, bool isUnitSeed ){
 
     if( seed == 0 ) return SUCCESSFUL_RETURN;
 
     int run1, run2;
     returnValue returnvalue;
 
-    const int nc = fcn[0].getDim();
+    const int nc    = fcn[0].getDim();
+    const int nVars = fcn[0].getNumberOfVariables()+1;
+    const int nCols = (int) seed->getNumCols();
+
+    const JacobianCompression& cols = columnCompression[0];
 
-    double* dresult1 = new double[nc                             ];
-    double*   fseed1 = new double[fcn[0].getNumberOfVariables()+1];
+    // structurally orthogonal columns of a unit seed share one direction:
+    const bool isCompressed = ( isUnitSeed == true ) && ( offset+nCols <= (int) cols.getNumCols() );
 
-    DMatrix tmp( nc, seed->getNumCols() );
+    int nDirs = nCols;
 
-    for( run1 = 0; run1 < (int) seed->getNumCols(); run1++ ){
+    if( isCompressed == true ){
+        nDirs = 0;
+        for( run1 = 0; run1 < nCols; run1++ )
+            if( cols.getColor( offset+run1 ) >= nDirs )
+                nDirs = cols.getColor( offset+run1 )+1;
+    }
+
+    DMatrix tmp( nc, nCols );
+    tmp.setZero();
+
+    if( nDirs == 0 ){
+        dForward.setDense( 0, offset2, tmp );
+        return SUCCESSFUL_RETURN;
+    }
 
-        for( run2 = 0; run2 <= fcn[0].getNumberOfVariables(); run2++ )
-            fseed1[run2] = 0.0;
+    double* dresult1 = new double[nc   *nDirs];
+    double*   fseed1 = new double[nVars*nDirs];
 
+    for( run2 = 0; run2 < nVars*nDirs; run2++ )
+        fseed1[run2] = 0.0;
+
+    if( isCompressed == true ){
+        for( run1 = 0; run1 < nCols; run1++ )
+            if( cols.getColor( offset+run1 ) >= 0 )
+                fseed1[y_index[0][offset+run1]*nDirs+cols.getColor( offset+run1 )] = 1.0;
+    }
+    else{
         for( run2 = 0; run2 < (int) seed->getNumRows(); run2++ )
-            fseed1[y_index[0][offset+run2]] = seed->operator()(run2,run1);
+            for( run1 = 0; run1 < nCols; run1++ )
+                fseed1[y_index[0][offset+run2]*nDirs+run1] = seed->operator()(run2,run1);
+    }
 
-        returnvalue = fcn[0].AD_forward( 0, fseed1, dresult1 );
-        if( returnvalue != SUCCESSFUL_RETURN ){
-            delete[] dresult1;
-            delete[] fseed1  ;
-            return ACADOERROR(returnvalue);
-        }
+    // ONE VECTOR-MODE FORWARD SWEEP FOR ALL DIRECTIONS:
+    // --------------------------------------------------
+    returnvalue = fcn[0].AD_forward( 0, nDirs, fseed1, dresult1 );
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        delete[] dresult1;
+        delete[] fseed1  ;
+        return ACADOERROR(returnvalue);
+    }
+
+    if( isCompressed == true ){
+        for( run1 = 0; run1 < nCols; run1++ )
+            if( cols.getColor( offset+run1 ) >= 0 )
+                for( run2 = 0; run2 < nc; run2++ )
+                    if( cols.isNonzero( run2, offset+run1 ) == true )
+                        tmp( run2, run1 ) = dresult1[run2*nDirs+cols.getColor( offset+run1 )];
+    }
+    else{
         for( run2 = 0; run2 < nc; run2++ )
-            tmp( run2, run1 ) = dresult1[run2];
+            for( run1 = 0; run1 < nCols; run1++ )
+                tmp( run2, run1 ) = dresult1[run2*nDirs+run1];
     }
     dForward.setDense( 0, offset2, tmp );
 
@@ -139,8 +139,10 @@ class PointConstraint : public ConstraintElement{
 	protected:
 
         /** only for internal use (routine which computes a part of the block
-         *  matrix needed for forward differentiation.) */
-        returnValue computeForwardSensitivityBlock( int offset, int offset2, DMatrix *seed );
+         *  matrix needed for forward differentiation.) All seed columns are
+         *  propagated by one vector-mode sweep; unit seeds are propagated in
+         *  compressed form, one direction per column color. */
+        returnValue computeForwardSensitivityBlock( int offset, int offset2, DMatrix *seed, bool isUnitSeed = false );
 
 
 
@@ -48,6 +48,7 @@ Curve::Curve( ){
     dim              = 0;
     parameterization = 0;
     grid             = 0;
+    lastIntervalIdx  = 0;
 }
 
 Curve::Curve( const Curve& arg ){
@@ -66,6 +67,8 @@ Curve::Curve( const Curve& arg ){
 
     if( arg.grid != 0 )  grid = new Grid(*arg.grid);
     else                 grid = 0;
+
+    lastIntervalIdx = 0;
 }
 
 
@@ -106,6 +109,8 @@ Curve& Curve::operator=( const Curve& arg ){
 
         if( arg.grid != 0 )  grid = new Grid(*arg.grid);
         else                 grid = 0;
+
+        lastIntervalIdx = 0;
     }
     return *this;
 }
@@ -334,10 +339,10 @@ returnValue Curve::evaluate( double t, double *result ) const{
         return ACADOERROR(RET_INVALID_ARGUMENTS);
 
 
-    // OBTAIN THE INTERVAL INDEX:
-    // --------------------------
+    // OBTAIN THE INTERVAL INDEX (STARTING AT THE ONE OF THE LAST EVALUATION):
+    // ----------------------------------------------------------------------
 
-    idx = grid->getFloorIndex(t);
+    idx = grid->getFloorIndex(t,lastIntervalIdx);
     if( idx == nIntervals ) idx--;
 
 
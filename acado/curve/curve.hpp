@@ -302,6 +302,7 @@ class Curve{
         uint                 dim             ;   // the dimension of the curve.
         Function           **parameterization;   // the parameterizations of the curve pieces
         Grid                *grid            ;   // the grid points associated with the intervals of the curve.
+        mutable uint         lastIntervalIdx ;   // index of the interval of the last evaluation (search hint).
 };
 
 
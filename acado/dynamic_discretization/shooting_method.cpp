@@ -94,6 +94,8 @@ void ShootingMethod::copy( const ShootingMethod &arg ){
     else integrator = 0;
 
     breakPoints = arg.breakPoints;
+
+    sensitivityCompression = arg.sensitivityCompression;
 }
 
 DynamicDiscretization* ShootingMethod::clone( ) const{
@@ -133,9 +135,17 @@ returnValue ShootingMethod::addStage( const DynamicSystem  &dynamicSystem_,
 
     integrator = (Integrator**)realloc(integrator,N*sizeof(Integrator*));
 
+    JacobianCompression compression[5];
+    if( integratorTypeTmp != INT_LYAPUNOV45 )
+        ACADO_TRY( setupSensitivityCompression( differentialEquation_, compression ) );
+
+    sensitivityCompression.resize( 5*N );
+
     while( run1 < N ){
         allocateIntegrator( run1, (IntegratorType) integratorTypeTmp );
         integrator[run1]->init( differentialEquation_ );
+        for( int run2 = 0; run2 < 5; run2++ )
+            sensitivityCompression[5*run1+run2] = compression[run2];
         run1++;
     }
 
@@ -186,6 +196,10 @@ returnValue ShootingMethod::addTransition( const Transition& transition_ ){
     if( transition_.getNXA() != 0 ) return ACADOERROR( RET_TRANSITION_DEPENDS_ON_ALGEBRAIC_STATES );
     integrator[N-1]->setTransition( transition_ );
 
+    // the sparsity pattern of the flow does not cover the transition:
+    for( int run1 = 0; run1 < 5; run1++ )
+        sensitivityCompression[5*(N-1)+run1] = JacobianCompression( );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -329,10 +343,36 @@ returnValue ShootingMethod::differentiateBackward( const int    &idx ,
                                                          DMatrix &Gx  ,
                                                          DMatrix &Gp  ,
                                                          DMatrix &Gu  ,
-                                                         DMatrix &Gw    ){
+                                                         DMatrix &Gw  ,
+                                                   const JacobianCompression *compression ){
 
     uint run1;
 
+    if( compression != 0 ){
+
+        // PROPAGATE ONE DIRECTION PER COLOR AND RECOVER THE UNIT SEED RESULT:
+        // -------------------------------------------------------------------
+        DMatrix S = compression->getSeed( );
+        DMatrix Gxc, Gpc, Guc, Gwc;
+
+        ACADO_TRY( differentiateBackward( idx, S.transpose(), Gxc, Gpc, Guc, Gwc ) );
+
+        DMatrix Gc( nx+np+nu+nw, S.getNumCols() ), G;
+        if( nx > 0 ) Gc.block(        0, 0, nx, S.getNumCols() ) = Gxc.transpose();
+        if( np > 0 ) Gc.block(       nx, 0, np, S.getNumCols() ) = Gpc.transpose();
+        if( nu > 0 ) Gc.block(    nx+np, 0, nu, S.getNumCols() ) = Guc.transpose();
+        if( nw > 0 ) Gc.block( nx+np+nu, 0, nw, S.getNumCols() ) = Gwc.transpose();
+
+        ACADO_TRY( compression->decompress( Gc, G ) );
+
+        Gx = G.block(        0, 0, nx, nx ).transpose();
+        Gp = G.block(       nx, 0, np, nx ).transpose();
+        Gu = G.block(    nx+np, 0, nu, nx ).transpose();
+        Gw = G.block( nx+np+nu, 0, nw, nx ).transpose();
+
+        return SUCCESSFUL_RETURN;
+    }
+
     Gx.init( seed.getNumRows(), nx );
     Gp.init( seed.getNumRows(), np );
     Gu.init( seed.getNumRows(), nu );
@@ -366,11 +406,27 @@ returnValue ShootingMethod::differentiateForward(  const int     &idx,
                                                    const DMatrix  &dP ,
                                                    const DMatrix  &dU ,
                                                    const DMatrix  &dW ,
-                                                         DMatrix  &D    ){
+                                                         DMatrix  &D  ,
+                                                   const JacobianCompression *compression ){
 
     int run1;
     int n = 0;
 
+    if( compression != 0 ){
+
+        // PROPAGATE ONE DIRECTION PER COLOR AND RECOVER THE UNIT SEED RESULT:
+        // -------------------------------------------------------------------
+        DMatrix S = compression->getSeed( );
+        DMatrix E, Dc;
+
+        ACADO_TRY( differentiateForward( idx, dX.isEmpty() == BT_FALSE ? S : E,
+                                              dP.isEmpty() == BT_FALSE ? S : E,
+                                              dU.isEmpty() == BT_FALSE ? S : E,
+                                              dW.isEmpty() == BT_FALSE ? S : E, Dc ) );
+
+        return compression->decompress( Dc, D );
+    }
+
     n = acadoMax( n, dX.getNumCols() );
     n = acadoMax( n, dP.getNumCols() );
     n = acadoMax( n, dU.getNumCols() );
@@ -398,6 +454,135 @@ returnValue ShootingMethod::differentiateForward(  const int     &idx,
 }
 
 
+returnValue ShootingMethod::setupSensitivityCompression( DifferentialEquation &differentialEquation_,
+                                                         JacobianCompression  *compression            ) const{
+
+    int run1, run2, run3;
+
+    if( differentialEquation_.isSymbolic()        == BT_FALSE ||
+        differentialEquation_.isODE()             == BT_FALSE ||
+        differentialEquation_.isImplicit()        == BT_TRUE  ||
+        differentialEquation_.getStartTimeIdx()   >= 0        ||
+        differentialEquation_.getEndTimeIdx()     >= 0        )
+        return SUCCESSFUL_RETURN;
+
+    // states that do not appear on any right-hand side are still integrated:
+    const int nEq = differentialEquation_.getNumDynamicEquations();
+    const int nX  = nEq;
+
+    BMatrix full;
+    ACADO_TRY( differentialEquation_.getDependencyPattern( full ) );
+
+    const int nVars = full.getNumCols()-1;
+    DVector   state = differentialEquation_.getDifferentialStateComponents();
+
+    for( run1 = 0; run1 < nEq; run1++ )
+        if( state(run1) < 0.0 || state(run1) >= (double) nX )
+            return SUCCESSFUL_RETURN;
+
+    // DIRECT DEPENDENCIES: A(i,j) <=> rhs of state i depends on state j
+    // -----------------------------------------------------------------
+    BMatrix A( nX, nX );
+    A.setAll( false );
+
+    for( run2 = 0; run2 < nX; run2++ ){
+        int k = differentialEquation_.index( VT_DIFFERENTIAL_STATE, run2 );
+        if( k < 0 || k >= nVars ) continue;
+        for( run1 = 0; run1 < nEq; run1++ )
+            if( full( run1, k ) == true )
+                A( (int) state(run1), run2 ) = true;
+    }
+
+    // STATES AT THE END OF THE INTERVAL DEPEND ON ALL REACHABLE STATES:
+    // -----------------------------------------------------------------
+    BMatrix R( nX, nX );
+    R.setAll( false );
+
+    std::vector< int > stack;
+    for( run2 = 0; run2 < nX; run2++ ){
+
+        R( run2, run2 ) = true;
+        stack.push_back( run2 );
+
+        while( stack.empty() == false ){
+            int k = stack.back();
+            stack.pop_back();
+            for( run1 = 0; run1 < nX; run1++ ){
+                if( A( run1, k ) == true && R( run1, run2 ) == false ){
+                    R( run1, run2 ) = true;
+                    stack.push_back( run1 );
+                }
+            }
+        }
+    }
+    ACADO_TRY( compression[0].init( R ) );
+
+    BMatrix rows( nX, nX+differentialEquation_.getNP()+differentialEquation_.getNU()+differentialEquation_.getNW() );
+    rows.block( 0, 0, nX, nX ) = R;
+
+    // PARAMETERS, CONTROLS AND DISTURBANCES ENTER THROUGH THE RHS:
+    // ------------------------------------------------------------
+    VariableType types[3] = { VT_PARAMETER, VT_CONTROL, VT_DISTURBANCE };
+    int          dims [3] = { differentialEquation_.getNP(), differentialEquation_.getNU(), differentialEquation_.getNW() };
+
+    int offset = 0;
+    for( int t = 0; t < 3; t++ ){
+
+        BMatrix G( nX, dims[t] );
+        G.setAll( false );
+
+        for( run2 = 0; run2 < dims[t]; run2++ ){
+            int k = differentialEquation_.index( types[t], run2 );
+            if( k < 0 || k >= nVars ) continue;
+            for( run1 = 0; run1 < nEq; run1++ )
+                if( full( run1, k ) == true )
+                    for( run3 = 0; run3 < nX; run3++ )
+                        if( R( run3, (int) state(run1) ) == true )
+                            G( run3, run2 ) = true;
+        }
+        ACADO_TRY( compression[1+t].init( G ) );
+
+        rows.block( 0, nX+offset, nX, dims[t] ) = G;
+        offset += dims[t];
+    }
+    ACADO_TRY( compression[4].init( rows.transpose() ) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+const JacobianCompression* ShootingMethod::getUnitSeedCompression( int                idx  ,
+                                                                   int                block,
+                                                                   const BlockMatrix &seed   ) const{
+
+    if( 5*idx+block >= (int) sensitivityCompression.size() )
+        return 0;
+
+    const JacobianCompression& compression = sensitivityCompression[5*idx+block];
+
+    if( compression.isCompressing() == BT_FALSE || seed.isEmpty() == BT_TRUE )
+        return 0;
+
+    if( block < 4 ){
+
+        // forward seeds are stored in the block column 0:
+        if( seed.isIdentity( idx, 0 ) == BT_FALSE ) return 0;
+        if( (int) compression.getNumRows() != nx || compression.getNumCols() != seed.getNumCols( idx, 0 ) ) return 0;
+    }
+    else{
+
+        // backward seeds are stored in the block row 0:
+        if( seed.isIdentity( 0, idx ) == BT_FALSE ) return 0;
+        if( (int) compression.getNumCols() != nx ) return 0;
+        if( (int) sensitivityCompression[5*idx+1].getNumCols() != np ||
+            (int) sensitivityCompression[5*idx+2].getNumCols() != nu ||
+            (int) sensitivityCompression[5*idx+3].getNumCols() != nw ) return 0;
+    }
+
+    return &compression;
+}
+
+
 returnValue ShootingMethod::differentiateForwardBackward( const int     &idx ,
                                                           const DMatrix  &dX  ,
                                                           const DMatrix  &dP  ,
@@ -480,7 +665,7 @@ returnValue ShootingMethod::evaluateSensitivities(){
              DMatrix seed, X, P, U, W;
              bSeed.getSubBlock( 0, i, seed );
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
+             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W, getUnitSeedCompression( i, 4, bSeed ) ) );
 
              if( nx > 0 ) dBackward.setDense( i, 0, X );
              if( np > 0 ) dBackward.setDense( i, 2, P );
@@ -505,10 +690,10 @@ returnValue ShootingMethod::evaluateSensitivities(){
         if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
         if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D, getUnitSeedCompression( i, 0, xSeed ) )); dForward.setDense( i, 0, D ); }
+        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D, getUnitSeedCompression( i, 1, pSeed ) )); dForward.setDense( i, 2, D ); }
+        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D, getUnitSeedCompression( i, 2, uSeed ) )); dForward.setDense( i, 3, D ); }
+        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D, getUnitSeedCompression( i, 3, wSeed ) )); dForward.setDense( i, 4, D ); }
     }
     return SUCCESSFUL_RETURN;
 }
@@ -693,6 +878,7 @@ returnValue ShootingMethod::deleteAll(){
         free(integrator);
         integrator = 0;
     }
+    sensitivityCompression.clear();
 
 	unionGrid.init();
 	DynamicDiscretization::initializeVariables( );
@@ -160,19 +160,50 @@ class ShootingMethod : public DynamicDiscretization
             returnValue allocateIntegrator( uint idx, IntegratorType type_ );
 
 
+            /** Propagates the rows of the given seed matrix backward through the
+             *  integrator of the given interval. If a compression is given, the seed
+             *  is a unit seed which is replaced by the compressed seed of the
+             *  compression, such that only one sweep per row color is needed.
+             */
             returnValue differentiateBackward( const int    &idx ,
                                                const DMatrix &seed,
                                                      DMatrix &Gx  ,
                                                      DMatrix &Gp  ,
                                                      DMatrix &Gu  ,
-                                                     DMatrix &Gw    );
-
+                                                     DMatrix &Gw  ,
+                                               const JacobianCompression *compression = 0 );
+
+            /** Propagates the columns of the given seed matrices through the integrator
+             *  of the given interval. If a compression is given, the (only non-empty)
+             *  seed is a unit seed which is replaced by the compressed seed of the
+             *  compression, such that only one sweep per column color is needed.
+             */
             returnValue differentiateForward(  const int     &idx,
                                                const DMatrix  &dX ,
                                                const DMatrix  &dP ,
                                                const DMatrix  &dU ,
                                                const DMatrix  &dW ,
-                                                     DMatrix  &D    );
+                                                     DMatrix  &D  ,
+                                               const JacobianCompression *compression = 0 );
+
+            /** Determines the structural sparsity of the sensitivities of the states
+             *  at the end of an integration interval w.r.t. x, p, u and w from the
+             *  dependency graph of the (explicit) differential equation and colors
+             *  the columns of each block as well as the rows of all blocks together
+             *  (stored in this order). Nothing is done for DAEs and implicit or free
+             *  end time problems.
+             *
+             *  \return SUCCESSFUL_RETURN
+             */
+            returnValue setupSensitivityCompression( DifferentialEquation &differentialEquation_,
+                                                     JacobianCompression  *compression            ) const;
+
+            /** Returns the compression of the given block (0-3: columns w.r.t. x, p, u, w;
+             *  4: rows) of the given interval if the (forward or backward) seed of this
+             *  interval is a unit seed of matching dimensions, and 0 otherwise. */
+            const JacobianCompression* getUnitSeedCompression( int                idx  ,
+                                                               int                block,
+                                                               const BlockMatrix &seed   ) const;
 
 
             returnValue differentiateForwardBackward( const int     &idx ,
@@ -213,6 +244,8 @@ class ShootingMethod : public DynamicDiscretization
 
             Integrator **integrator;
             DMatrix       breakPoints;
+
+            std::vector< JacobianCompression > sensitivityCompression;   /**< colored sensitivity columns (x,p,u,w) and rows per interval */
 };
 
 
@@ -105,6 +105,11 @@ returnValue CFunction::initialize(){
     nn            = 0;
     maxAlloc      = 1;
 
+    cFcnJacobian  = NULL;
+    cFcnBatch     = NULL;
+
+    hasSparsityPattern = BT_FALSE;
+
     xStore    = (double**)calloc(maxAlloc, sizeof(double*));
     seedStore = (double**)calloc(maxAlloc, sizeof(double*));
 
@@ -126,9 +131,17 @@ void CFunction::copy( const CFunction &arg ){
     if( arg.cFcnDBackward == 0 ) cFcnDBackward = 0                ;
     else                         cFcnDBackward = arg.cFcnDBackward;
 
+    cFcnJacobian = arg.cFcnJacobian;
+    cFcnBatch    = arg.cFcnBatch   ;
+
     dim = arg.dim;
     nn  = arg.nn ;
 
+    columns            = arg.columns           ;
+    hasSparsityPattern = arg.hasSparsityPattern;
+    jacobianStore      = arg.jacobianStore     ;
+    forwardDirections  = arg.forwardDirections ;
+
     user_data = arg.user_data;
 
     maxAlloc = arg.maxAlloc;
@@ -259,6 +272,7 @@ returnValue CFunction::evaluate( int number, double *x, double *result ){
     for( run2 = 0; run2 < nn; run2++ ){
         xStore[number][run2] = x[run2];
     }
+    clearJacobian( number );
 
     return SUCCESSFUL_RETURN;
 }
@@ -314,6 +328,8 @@ returnValue CFunction::AD_forward( int number, double *x, double *seed, double *
         maxAlloc = number+1;
     }
 
+    clearJacobian( number );
+
     if( cFcnDForward != NULL ){
         cFcnDForward( number, x, seed, f, df, user_data );
 
@@ -325,6 +341,16 @@ returnValue CFunction::AD_forward( int number, double *x, double *seed, double *
         return SUCCESSFUL_RETURN;
     }
 
+    if( cFcnJacobian != NULL ){
+
+        evaluate( x, f );
+
+        for( run1 = 0; run1 < nn; run1++ )
+            xStore[number][run1] = x[run1];
+
+        return AD_forward( number, seed, df );
+    }
+
     if( cFcn != 0 )
         cFcn( x, f, user_data );
     else evaluateCFunction( x, f );
@@ -344,19 +370,24 @@ returnValue CFunction::AD_forward( int number, double *x, double *seed, double *
         x[run1] = xStore[number][run1];
     }
 
+    if( number >= (int) forwardDirections.size() )
+        forwardDirections.resize( number+1, 0 );
+    forwardDirections[number]++;
+
     return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CFunction::AD_forward( int number, double *seed, double *df ){
 
-    uint run1;
+    uint run1, run2;
 
     ASSERT( number < (int) maxAlloc );
 
-    double *f = new double[dim];
-
     if( cFcnDForward != NULL ){
+
+        double *f = new double[dim];
+
         cFcnDForward( number, xStore[number], seed, f, df, user_data );
 
         for( run1 = 0; run1 < nn; run1++ )
@@ -366,29 +397,61 @@ returnValue CFunction::AD_forward( int number, double *seed, double *df ){
         return SUCCESSFUL_RETURN;
     }
 
-    if( cFcn != 0 )
-        cFcn( xStore[number], f, user_data );
-    else evaluateCFunction( xStore[number], f );
+    if( number >= (int) forwardDirections.size() )
+        forwardDirections.resize( number+1, 0 );
 
-    for( run1 = 0; run1 < nn; run1++ ){
-        xStore[number][run1] = xStore[number][run1] + SQRT_EPS*seed[run1];
-    }
+    // A SINGLE DIRECTION IS OBTAINED BY A DIRECTIONAL DIFFERENCE, THE
+    // (COMPRESSED) JACOBIAN ONLY PAYS OFF ONCE SEVERAL DIRECTIONS ARE
+    // REQUESTED AT THE SAME EVALUATION POINT:
+    // ---------------------------------------------------------------
+    const BooleanType hasJacobian = ( number < (int) jacobianStore.size() && jacobianStore[number].size() == dim*nn ) ? BT_TRUE : BT_FALSE;
 
-    if( cFcn != 0 )
-        cFcn( xStore[number], df, user_data );
-    else evaluateCFunction( xStore[number], df );
-    for( run1 = 0; run1 < dim; run1++ ){
-        df[run1] = ( df[run1] - f[run1] )/SQRT_EPS;
-    }
-    for( run1 = 0; run1 < nn; run1++ ){
-        xStore[number][run1] = xStore[number][run1] - SQRT_EPS*seed[run1];
+    if( hasJacobian == BT_FALSE && cFcnJacobian == NULL &&
+        ( ( hasSparsityPattern == BT_FALSE && cFcnBatch == NULL ) || forwardDirections[number] == 0 ) ){
+
+        double *f = new double[dim];
+
+        if( cFcn != 0 )
+            cFcn( xStore[number], f, user_data );
+        else evaluateCFunction( xStore[number], f );
+
+        for( run1 = 0; run1 < nn; run1++ ){
+            xStore[number][run1] = xStore[number][run1] + SQRT_EPS*seed[run1];
+        }
+
+        if( cFcn != 0 )
+            cFcn( xStore[number], df, user_data );
+        else evaluateCFunction( xStore[number], df );
+        for( run1 = 0; run1 < dim; run1++ ){
+            df[run1] = ( df[run1] - f[run1] )/SQRT_EPS;
+        }
+        for( run1 = 0; run1 < nn; run1++ ){
+            xStore[number][run1] = xStore[number][run1] - SQRT_EPS*seed[run1];
+        }
+
+        for( run1 = 0; run1 < nn; run1++ ){
+            seedStore[number][run1] = seed[run1];
+        }
+        forwardDirections[number]++;
+
+        delete[] f;
+        return SUCCESSFUL_RETURN;
     }
 
-    for( run1 = 0; run1 < nn; run1++ ){
-        seedStore[number][run1] = seed[run1];
+    if( hasJacobian == BT_FALSE )
+        ACADO_TRY( computeJacobian( number ) );
+
+    const std::vector< double >& J = jacobianStore[number];
+
+    for( run2 = 0; run2 < dim; run2++ ){
+        df[run2] = 0.0;
+        for( run1 = 0; run1 < nn; run1++ )
+            df[run2] += J[run2*nn+run1]*seed[run1];
     }
 
-    delete[] f;
+    for( run1 = 0; run1 < nn; run1++ )
+        seedStore[number][run1] = seed[run1];
+    forwardDirections[number]++;
 
     return SUCCESSFUL_RETURN;
 }
@@ -403,7 +466,7 @@ returnValue CFunction::AD_backward( double *seed, double  *df ){
 
 returnValue CFunction::AD_backward( int number, double *seed, double  *df ){
 
-    uint run1;
+    uint run1, run2;
 
     ASSERT( number < (int) maxAlloc );
 
@@ -419,7 +482,19 @@ returnValue CFunction::AD_backward( int number, double *seed, double  *df ){
         delete[] f;
         return SUCCESSFUL_RETURN;
     }
-    return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
+
+    if( number >= (int) jacobianStore.size() || jacobianStore[number].size() != dim*nn )
+        ACADO_TRY( computeJacobian( number ) );
+
+    const std::vector< double >& J = jacobianStore[number];
+
+    for( run1 = 0; run1 < nn; run1++ ){
+        df[run1] = 0.0;
+        for( run2 = 0; run2 < dim; run2++ )
+            df[run1] += J[run2*nn+run1]*seed[run2];
+    }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -531,6 +606,8 @@ returnValue CFunction::clearBuffer(){
         xStore= (double**)realloc( xStore, maxAlloc*sizeof(double*) );
         seedStore = (double**)realloc( seedStore, maxAlloc*sizeof(double*) );
     }
+    jacobianStore.clear();
+    forwardDirections.clear();
 
     return SUCCESSFUL_RETURN;
 }
@@ -544,6 +621,119 @@ returnValue CFunction::setUserData( void * user_data_){
 }
 
 
+returnValue CFunction::setJacobian( cFcnJacobianPtr cFcnJacobian_ ){
+
+    cFcnJacobian = cFcnJacobian_;
+    jacobianStore.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::setBatchEvaluation( cFcnBatchPtr cFcnBatch_ ){
+
+    cFcnBatch = cFcnBatch_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::setSparsityPattern( const BMatrix& pattern ){
+
+    if( pattern.getNumRows() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    columns.init( pattern );
+    hasSparsityPattern = BT_TRUE;
+    jacobianStore.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue CFunction::computeJacobian( int number ){
+
+    uint run1, run2;
+    int  run3;
+
+    if( number >= (int) jacobianStore.size() )
+        jacobianStore.resize( number+1 );
+
+    std::vector< double >& J = jacobianStore[number];
+    J.assign( dim*nn, 0.0 );
+
+    if( dim == 0 || nn == 0 )
+        return SUCCESSFUL_RETURN;
+
+    if( cFcnJacobian != NULL ){
+        cFcnJacobian( xStore[number], &J[0], user_data );
+        return SUCCESSFUL_RETURN;
+    }
+
+    // COLORED FINITE DIFFERENCES:
+    // ---------------------------
+    // all columns of the same color are perturbed at once; the first
+    // point is the unperturbed one.
+
+    if( columns.getNumRows() != dim || columns.getNumCols() != nn ){
+
+        BMatrix dense( dim, nn );
+        dense.setAll( true );
+        columns.init( dense );
+    }
+
+    const int nPoints = columns.getNumColors()+1;
+
+    std::vector< double > X( nPoints*nn  );
+    std::vector< double > F( nPoints*dim );
+
+    for( run3 = 0; run3 < nPoints; run3++ )
+        for( run1 = 0; run1 < nn; run1++ )
+            X[run3*nn+run1] = xStore[number][run1];
+
+    for( run1 = 0; run1 < nn; run1++ )
+        if( columns.getColor( run1 ) >= 0 )
+            X[(columns.getColor( run1 )+1)*nn+run1] += SQRT_EPS*( 1.0 + fabs( xStore[number][run1] ) );
+
+    if( cFcnBatch != NULL ){
+        cFcnBatch( nPoints, &X[0], &F[0], user_data );
+    }
+    else{
+        for( run3 = 0; run3 < nPoints; run3++ )
+            evaluate( &X[run3*nn], &F[run3*dim] );
+    }
+
+    for( run1 = 0; run1 < nn; run1++ ){
+
+        const int color = columns.getColor( run1 );
+        if( color < 0 ) continue;
+
+        // the representable step size:
+        const double h = X[(color+1)*nn+run1] - X[run1];
+
+        for( run2 = 0; run2 < dim; run2++ )
+            if( columns.isNonzero( run2, run1 ) == true )
+                J[run2*nn+run1] = ( F[(color+1)*dim+run2] - F[run2] )/h;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void CFunction::clearJacobian( int number ){
+
+    if( number < (int) jacobianStore.size() )
+        jacobianStore[number].clear();
+    if( number < (int) forwardDirections.size() )
+        forwardDirections[number] = 0;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
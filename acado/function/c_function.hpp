@@ -37,6 +37,7 @@
 
 
 #include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/jacobian_compression.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -259,6 +260,34 @@ class CFunction{
      virtual returnValue setUserData( void * user_data_ /**< the user-defined pointer */ );
 
 
+    /** Specifies a C-function that evaluates the full Jacobian   \n
+     *  (row-major, dim x nx) of the C-function. If set, it is    \n
+     *  used instead of finite differences whenever no forward    \n
+     *  or backward derivative function is given.                 \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue setJacobian( cFcnJacobianPtr cFcnJacobian_ /**< function pointer to the Jacobian */ );
+
+
+    /** Specifies a C-function that evaluates the C-function at   \n
+     *  several points at once. If set, all perturbed points of   \n
+     *  a finite difference Jacobian are passed in a single call. \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue setBatchEvaluation( cFcnBatchPtr cFcnBatch_ /**< function pointer for batch evaluations */ );
+
+
+    /** Specifies the sparsity pattern (dim x nx) of the Jacobian \n
+     *  of the C-function. Structurally orthogonal columns are    \n
+     *  perturbed simultaneously when the Jacobian is computed by \n
+     *  finite differences. By default, the Jacobian is dense.    \n
+     *  The Jacobian is only formed once a second forward         \n
+     *  direction is requested at the same evaluation point.      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue setSparsityPattern( const BMatrix& pattern /**< the sparsity pattern */ );
+
+
 
 //
 //  PROTECTED FUNCTIONS:
@@ -276,6 +305,20 @@ protected:
      void deleteAll();
 
 
+     /** Computes the Jacobian at the evaluation point stored at  \n
+      *  given buffer position, either by the user-defined        \n
+      *  Jacobian function or by colored finite differences.      \n
+      *  \return SUCCESFUL_RETURN                                 \n
+      */
+     returnValue computeJacobian( int number /**< storage position */ );
+
+
+     /** Marks the Jacobian stored at given buffer position as    \n
+      *  outdated and resets its count of forward directions.     \n
+      */
+     void clearJacobian( int number /**< storage position */ );
+
+
 
 //
 //  PROTECTED MEMBERS:
@@ -290,6 +333,9 @@ protected:
         cFcnDPtr  cFcnDForward ;
         cFcnDPtr  cFcnDBackward;
 
+        cFcnJacobianPtr cFcnJacobian;    /**< user-defined Jacobian (optional)          */
+        cFcnBatchPtr    cFcnBatch   ;    /**< user-defined batch evaluation (optional)  */
+
   
 	void* user_data        ;    /**< pointer specified by the setUserData function, passed to the c function when being called */
 
@@ -300,6 +346,13 @@ protected:
         uint     maxAlloc      ;    /**< actual memory allocation         */
         double **xStore        ;    /**< storage of evaluation variables  */
         double **seedStore     ;    /**< storage of evaluation seeds      */
+
+        JacobianCompression columns;    /**< coloring of the columns of the Jacobian  */
+        BooleanType hasSparsityPattern; /**< whether a sparsity pattern has been set  */
+        std::vector< std::vector< double > > jacobianStore; /**< Jacobians at the stored
+                                                             *   evaluation points (empty if outdated) */
+        std::vector< uint > forwardDirections; /**< number of forward directions evaluated
+                                                *   at the stored evaluation points        */
 };
 
 
@@ -33,6 +33,7 @@
 
 
 #include <acado/utils/acado_utils.hpp>
+#include <acado/clock/profiler.hpp>
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 #include <acado/function/evaluation_point.hpp>
 #include <acado/function/function_.hpp>
@@ -276,6 +277,8 @@ Operator* Function::getExpression( uint componentIdx ) const{
 
 returnValue Function::evaluate( int number, double *x, double *_result ){
 
+    ACADO_PROFILE( "function evaluation" );
+
 //     return evaluationTree.evaluate( number+memoryOffset, x, _result );
 
     evaluationTree.evaluate( number+memoryOffset, x, _result );
@@ -316,6 +319,11 @@ BooleanType Function::isDependingOn( const Expression     &variable ){
     return evaluationTree.isDependingOn( variable );
 }
 
+returnValue Function::getDependencyPattern( BMatrix &pattern ){
+
+    return evaluationTree.getDependencyPattern( pattern );
+}
+
 BooleanType Function::isLinearIn( const Expression     &variable ){
 
     return evaluationTree.isLinearIn( variable );
@@ -375,6 +383,22 @@ BooleanType Function::isAffine(){
 }
 
 
+BooleanType Function::isAffine( uint componentIdx ){
+
+    if( (int) componentIdx >= getDim() || isSymbolic() == BT_FALSE )
+        return BT_FALSE;
+
+    Operator *component = getExpression( componentIdx );
+    CurvatureType curvature = component->getCurvature();
+    delete component;
+
+    if( curvature == CT_AFFINE || curvature == CT_CONSTANT )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
 BooleanType Function::isConvex(){
 
 
@@ -428,19 +452,41 @@ returnValue Function::jacobian(DMatrix &x) {
 
 returnValue Function::AD_forward( int number, double *seed, double *df  ){
 
+    ACADO_PROFILE( "AD forward" );
+
     return evaluationTree.AD_forward( number+memoryOffset, seed, df );
 }
 
 
 returnValue Function::AD_backward( int number, double *seed, double  *df ){
 
+    ACADO_PROFILE( "AD backward" );
+
     return evaluationTree.AD_backward( number+memoryOffset, seed, df );
 }
 
 
+returnValue Function::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    ACADO_PROFILE( "AD forward" );
+
+    return evaluationTree.AD_forward( number+memoryOffset, nDirs, seed, df );
+}
+
+
+returnValue Function::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    ACADO_PROFILE( "AD backward" );
+
+    return evaluationTree.AD_backward( number+memoryOffset, nDirs, seed, df );
+}
+
+
 returnValue Function::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
+    ACADO_PROFILE( "AD forward (2nd order)" );
+
     return evaluationTree.AD_forward2( number+memoryOffset, seed, dseed, df, ddf );
 }
 
@@ -448,6 +494,8 @@ returnValue Function::AD_forward2( int number, double *seed, double *dseed,
 returnValue Function::AD_backward2( int number, double *seed1, double *seed2,
                                     double *df, double *ddf ){
 
+    ACADO_PROFILE( "AD backward (2nd order)" );
+
     return evaluationTree.AD_backward2( number+memoryOffset, seed1, seed2, df, ddf );
 }
 
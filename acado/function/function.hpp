@@ -42,6 +42,7 @@
 #include <acado/function/evaluation_point.hpp>
 #include <acado/function/t_evaluation_point.hpp>
 #include <acado/function/function_.hpp>
+#include <acado/function/jacobian_compression.hpp>
 #include <acado/function/c_function.hpp>
 #include <acado/function/differential_equation.hpp>
 #include <acado/function/transition.hpp>
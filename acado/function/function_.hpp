@@ -268,6 +268,15 @@ public:
      BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines the structural sparsity pattern of the Jacobian  \n
+     *  from the dependencies of the operators, see                 \n
+     *  FunctionEvaluationTree::getDependencyPattern.               \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *
+     */
+     returnValue getDependencyPattern( BMatrix &pattern );
+
+
 
     /** Checks whether the function is linear in                  \n
      *  (or not depending on)  var(index)                         \n
@@ -327,6 +336,17 @@ public:
      BooleanType isAffine();
 
 
+    /** Checks whether the component with given index is affine   \n
+     *  in all variables, i.e. whether its derivatives are        \n
+     *  constant.                                                 \n
+     *  \return BT_FALSE if the component is not detected to be   \n
+     *                   affine (or not symbolic)                 \n
+     *          BT_TRUE  otherwise                                \n
+     *
+     */
+     BooleanType isAffine( uint componentIdx );
+
+
     /** Checks whether the function is convex.                    \n
      *  \return BT_FALSE if the expression is not (DCP-) convex   \n
      *          BT_TRUE  otherwise                                \n
@@ -395,6 +415,38 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDirs       \n
+     *  directions at once (vector mode) based on buffered values.\n
+     *  The tangents are stored contiguously per variable, i.e.   \n
+     *  seed[i*nDirs+k] is the k-th tangent of variable i and     \n
+     *  df[j*nDirs+k] the k-th derivative of component j.         \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_forward(  int     number  /**< storage position     */,
+                              int     nDirs   /**< number of directions */,
+                              double *seed    /**< the seeds            */,
+                              double *df      /**< the derivatives of
+                                                   the expression       */  );
+
+
+
+    /** Automatic Differentiation in backward mode for nDirs      \n
+     *  directions at once (vector mode) based on buffered values.\n
+     *  The seed of component j in direction k is seed[j*nDirs+k];\n
+     *  the derivatives are added to df[i*nDirs+k].               \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_backward( int     number /**< the buffer
+                                                  position             */,
+                              int     nDirs  /**< number of directions */,
+                              double *seed   /**< the seeds            */,
+                              double *df     /**< the derivatives of
+                                                  the expression       */  );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
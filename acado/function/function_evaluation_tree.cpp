@@ -486,6 +486,43 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getDependencyPattern( BMatrix &pattern ){
+
+    const int nVars = getNumberOfVariables();
+
+    pattern.init( dim, nVars+1 );
+    pattern.setAll( false );
+
+    const int nTypes = 10;
+    VariableType types [nTypes] = { VT_DIFFERENTIAL_STATE, VT_ALGEBRAIC_STATE, VT_CONTROL,
+                                     VT_INTEGER_CONTROL, VT_PARAMETER, VT_INTEGER_PARAMETER,
+                                     VT_DISTURBANCE, VT_TIME, VT_DDIFFERENTIAL_STATE, VT_ONLINE_DATA };
+    int          counts[nTypes] = { getNX(), getNXA(), getNU(), getNUI(), getNP(), getNPI(),
+                                    getNW(), getNT(), getNDX(), getNOD() };
+
+    BooleanType *implicit_dep = new BooleanType[n];
+
+    int run1, run2, run3;
+    for( run1 = 0; run1 < nTypes; run1++ ){
+        for( run2 = 0; run2 < counts[run1]; run2++ ){
+
+            int idx = index( types[run1], run2 );
+            if( idx < 0 || idx >= nVars ) continue;
+
+            for( run3 = 0; run3 < n; run3++ )
+                implicit_dep[run3] = sub[run3]->isDependingOn( 1, &types[run1], &run2, implicit_dep );
+
+            for( run3 = 0; run3 < dim; run3++ )
+                if( f[run3]->isDependingOn( 1, &types[run1], &run2, implicit_dep ) == BT_TRUE )
+                    pattern( run3,idx ) = true;
+        }
+    }
+
+    delete[] implicit_dep;
+    return SUCCESSFUL_RETURN;
+}
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
@@ -808,6 +845,102 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 }
 
 
+returnValue FunctionEvaluationTree::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1, run2, run3;
+
+    if( nDirs <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    if( isSymbolic() == BT_TRUE ){
+
+        for( run1 = 0; run1 < n; run1++ ){
+            sub[run1]->AD_forward( number, nDirs, seed,
+                             &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])*nDirs ] );
+        }
+        for( run1 = 0; run1 < dim; run1++ ){
+            f[run1]->AD_forward( number, nDirs, seed, &df[run1*nDirs] );
+        }
+        return SUCCESSFUL_RETURN;
+    }
+
+    // C-functions are differentiated one direction after the other:
+    const int nVars = getNumberOfVariables()+1;
+    double *seed_ = new double[nVars];
+    double *df_   = new double[dim  ];
+
+    for( run3 = 0; run3 < nDirs; run3++ ){
+
+        for( run2 = 0; run2 < nVars; run2++ )
+            seed_[run2] = seed[run2*nDirs+run3];
+
+        if( AD_forward( number, seed_, df_ ) != SUCCESSFUL_RETURN ){
+            delete[] seed_;
+            delete[] df_;
+            return ACADOERROR( RET_UNKNOWN_BUG );
+        }
+
+        for( run1 = 0; run1 < dim; run1++ )
+            df[run1*nDirs+run3] = df_[run1];
+    }
+
+    delete[] seed_;
+    delete[] df_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1, run2, run3;
+
+    if( nDirs <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    if( isSymbolic() == BT_TRUE ){
+
+        for( run1 = dim-1; run1 >= 0; run1-- ){
+            f[run1]->AD_backward( number, nDirs, &seed[run1*nDirs], df );
+        }
+        for( run1 = n-1; run1 >= 0; run1-- ){
+            sub[run1]->AD_backward( number, nDirs,
+                                    &df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])*nDirs ],
+                                    df );
+        }
+        return SUCCESSFUL_RETURN;
+    }
+
+    // C-functions do not support backward sweeps; the Jacobian is
+    // computed column-wise in forward mode and applied to all seeds:
+    const int nVars = getNumberOfVariables()+1;
+    double *seed_ = new double[nVars];
+    double *J     = new double[dim  ];
+
+    for( run2 = 0; run2 < nVars; run2++ ){
+
+        for( run1 = 0; run1 < nVars; run1++ )
+            seed_[run1] = 0.0;
+        seed_[run2] = 1.0;
+
+        if( AD_forward( number, seed_, J ) != SUCCESSFUL_RETURN ){
+            delete[] seed_;
+            delete[] J;
+            return ACADOERROR( RET_UNKNOWN_BUG );
+        }
+
+        for( run3 = 0; run3 < nDirs; run3++ )
+            for( run1 = 0; run1 < dim; run1++ )
+                df[run2*nDirs+run3] += J[run1]*seed[run1*nDirs+run3];
+    }
+
+    delete[] seed_;
+    delete[] J;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
                                              double *dseed, double *df,
                                              double *ddf ){
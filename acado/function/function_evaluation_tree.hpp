@@ -241,6 +241,16 @@ public:
      virtual BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines the structural sparsity pattern of the Jacobian,  \n
+     *  i.e. pattern(i,j) is true iff the i-th component depends     \n
+     *  on the variable with (AD-)index j. The pattern has           \n
+     *  getNumberOfVariables()+1 columns like the AD seeds.          \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *
+     */
+     virtual returnValue getDependencyPattern( BMatrix &pattern );
+
+
     /** Checks whether the symbolic expression is linear in       \n
      *  a specified variable.                                     \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -363,6 +373,44 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDirs       \n
+     *  directions at once (vector mode). The seed stores the     \n
+     *  nDirs tangents of each variable contiguously, i.e.        \n
+     *  seed[i*nDirs+k] is the k-th tangent of variable i, and    \n
+     *  df[j*nDirs+k] receives the k-th derivative of component j.\n
+     *  This function uses the intermediate results from a buffer \n
+     *  but, unlike the single-direction version, does not store  \n
+     *  derivatives for a subsequent 2nd order sweep.             \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDirs   /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the derivatives of
+                                                          the expression       */  );
+
+
+
+    // IMPORTANT REMARK FOR AD_BACKWARD: run evaluate first to define
+    //                                   the point x and to compute f.
+
+    /** Automatic Differentiation in backward mode for nDirs      \n
+     *  directions at once (vector mode) based on buffered values.\n
+     *  The seed of component j in direction k is seed[j*nDirs+k];\n
+     *  the derivatives are added to df[i*nDirs+k].               \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer
+                                                          position             */,
+                                      int     nDirs  /**< number of directions */,
+                                      double *seed   /**< the seeds            */,
+                                      double *df     /**< the derivatives of
+                                                          the expression       */);
+
+
+
 
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
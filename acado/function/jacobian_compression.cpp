@@ -0,0 +1,165 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/function/jacobian_compression.cpp
+ */
+
+
+#include <acado/function/jacobian_compression.hpp>
+
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+JacobianCompression::JacobianCompression( )
+{
+	nColors = 0;
+}
+
+
+JacobianCompression::JacobianCompression(	const BMatrix& _pattern
+											)
+{
+	init( _pattern );
+}
+
+
+JacobianCompression::~JacobianCompression( )
+{
+}
+
+
+
+returnValue JacobianCompression::init(	const BMatrix& _pattern
+										)
+{
+	pattern = _pattern;
+
+	const uint nRows = pattern.getNumRows( );
+	const uint nCols = pattern.getNumCols( );
+
+	colors.assign( nCols,-1 );
+	nColors = 0;
+
+	// columns in order of decreasing number of nonzeros
+	std::vector< uint > nnz( nCols,0 );
+	std::vector< std::pair< uint,uint > > order;
+	std::vector< std::vector< uint > > rowCols( nRows );
+
+	for( uint j=0; j<nCols; ++j )
+	{
+		for( uint i=0; i<nRows; ++i )
+		{
+			if ( pattern( i,j ) == true )
+			{
+				rowCols[ i ].push_back( j );
+				++nnz[ j ];
+			}
+		}
+
+		if ( nnz[ j ] > 0 )
+			order.push_back( std::make_pair( nCols-nnz[ j ],j ) );
+	}
+	std::sort( order.begin( ),order.end( ) );
+
+	// greedy coloring of the column intersection graph: colors of columns sharing
+	// a row with the current column are marked as forbidden (by the column index)
+	std::vector< uint > forbidden( nCols,nCols );
+
+	for( uint k=0; k<order.size( ); ++k )
+	{
+		uint j = order[ k ].second;
+
+		for( uint i=0; i<nRows; ++i )
+		{
+			if ( pattern( i,j ) == false )
+				continue;
+
+			for( uint l=0; l<rowCols[ i ].size( ); ++l )
+				if ( colors[ rowCols[ i ][ l ] ] >= 0 )
+					forbidden[ colors[ rowCols[ i ][ l ] ] ] = j;
+		}
+
+		uint color = 0;
+		while( forbidden[ color ] == j )
+			++color;
+
+		colors[ j ] = color;
+		if ( color+1 > nColors )
+			nColors = color+1;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+DMatrix JacobianCompression::getSeed( ) const
+{
+	DMatrix seed( getNumCols( ),nColors );
+	seed.setZero( );
+
+	for( uint j=0; j<getNumCols( ); ++j )
+		if ( colors[ j ] >= 0 )
+			seed( j,colors[ j ] ) = 1.0;
+
+	return seed;
+}
+
+
+returnValue JacobianCompression::decompress(	const DMatrix& compressed,
+												DMatrix& jacobian
+												) const
+{
+	if ( ( compressed.getNumRows( ) != getNumRows( ) ) || ( compressed.getNumCols( ) != nColors ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	jacobian.init( getNumRows( ),getNumCols( ) );
+	jacobian.setZero( );
+
+	for( uint j=0; j<getNumCols( ); ++j )
+		for( uint i=0; i<getNumRows( ); ++i )
+			if ( pattern( i,j ) == true )
+				jacobian( i,j ) = compressed( i,colors[ j ] );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,187 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/function/jacobian_compression.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_JACOBIAN_COMPRESSION_HPP
+#define ACADO_TOOLKIT_JACOBIAN_COMPRESSION_HPP
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Compresses sparse Jacobians by grouping structurally orthogonal columns.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class JacobianCompression computes a coloring of the columns of a
+ *	Jacobian with given sparsity pattern such that no two columns of the same
+ *	color have a nonzero entry in a common row (Curtis-Powell-Reid). Instead of
+ *	one unit direction per column, a single forward direction per color, i.e.
+ *	the sum of the unit directions of all columns of that color, is propagated;
+ *	each entry of the Jacobian can be read off the compressed result.
+ *
+ *	For reverse mode, the coloring is computed for the transposed pattern: then
+ *	all rows of the same color are seeded by a single backward direction.
+ *
+ *	Columns are colored greedily in order of decreasing number of nonzeros;
+ *	structurally zero columns do not get a color at all.
+ */
+class JacobianCompression
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor, sets up an empty compression.
+		 */
+        JacobianCompression( );
+
+        /** Constructor that colors the columns of given sparsity pattern,
+		 *	see init() for details.
+		 *
+		 *	@param[in] _pattern		Sparsity pattern of the Jacobian.
+		 */
+        JacobianCompression(	const BMatrix& _pattern
+								);
+
+        /** Destructor.
+		 */
+        ~JacobianCompression( );
+
+
+		/** Colors the columns of given sparsity pattern.
+		 *
+		 *	@param[in] _pattern		Sparsity pattern of the Jacobian.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue init(	const BMatrix& _pattern
+							);
+
+
+		/** Returns number of rows of the Jacobian.
+		 *
+		 *	\return Number of rows
+		 */
+		inline uint getNumRows( ) const;
+
+		/** Returns number of columns of the Jacobian.
+		 *
+		 *	\return Number of columns
+		 */
+		inline uint getNumCols( ) const;
+
+		/** Returns number of colors, i.e. the number of directions to be
+		 *	propagated for computing the full Jacobian.
+		 *
+		 *	\return Number of colors
+		 */
+		inline uint getNumColors( ) const;
+
+		/** Returns color of column with given index.
+		 *
+		 *	@param[in] colIdx		Index of column.
+		 *
+		 *	\return Color of column, \n
+		 *	        -1 if column is structurally zero
+		 */
+		inline int getColor(	uint colIdx
+								) const;
+
+		/** Returns whether the Jacobian entry with given indices is a
+		 *	structural nonzero.
+		 *
+		 *	@param[in] rowIdx		Index of row.
+		 *	@param[in] colIdx		Index of column.
+		 *
+		 *	\return true iff entry is a structural nonzero
+		 */
+		inline bool isNonzero(	uint rowIdx,
+								uint colIdx
+								) const;
+
+		/** Returns whether less colors than columns are needed.
+		 *
+		 *	\return BT_TRUE  iff compression saves directions, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isCompressing( ) const;
+
+
+		/** Returns the (nCols x nColors) seed matrix whose k-th column is the
+		 *	sum of the unit directions of all columns with color k.
+		 *
+		 *	\return Compressed seed matrix
+		 */
+		DMatrix getSeed( ) const;
+
+		/** Recovers the Jacobian from the (nRows x nColors) product of the
+		 *	Jacobian with the compressed seed matrix.
+		 *
+		 *	@param[in]  compressed	Compressed Jacobian.
+		 *	@param[out] jacobian	Full Jacobian.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue decompress(	const DMatrix& compressed,
+								DMatrix& jacobian
+								) const;
+
+
+    //
+    // PROTECTED DATA MEMBERS:
+    //
+    protected:
+
+		BMatrix pattern;				/**< Sparsity pattern of the Jacobian. */
+		std::vector< int > colors;		/**< Color of each column (-1 for structurally zero columns). */
+		uint nColors;					/**< Number of colors. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/jacobian_compression.ipp>
+
+
+#endif  // ACADO_TOOLKIT_JACOBIAN_COMPRESSION_HPP
+
+/*
+ *	end of file
+ */
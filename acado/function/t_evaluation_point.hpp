@@ -212,7 +212,7 @@ template <typename T> returnValue TevaluationPoint<T>::init( const Function &f ,
     nd = acadoMax( nd_, f.getNDX()                 );
     N  = acadoMax( N_ , f.getNumberOfVariables()+1 );
 
-    z = new Tmatrix<T>(N);
+    z = new Tmatrix<T>(N,1,0.0);
 
     idx = new int*[7];
 
@@ -32,6 +32,7 @@
  */
 
 #include <acado/utils/acado_utils.hpp>
+#include <acado/clock/profiler.hpp>
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 #include <acado/function/function_.hpp>
 #include <acado/function/differential_equation.hpp>
@@ -82,6 +83,7 @@ Integrator::Integrator( )
 
     tune  = 0.5      ;
     TOL   = 0.000001 ;
+    ATOL  = 0.000001 ;
 
 
     // INTERNAL INDEX LISTS:
@@ -259,6 +261,8 @@ returnValue Integrator::integrate(	const Grid   &t_  ,
 									const DVector &u   ,
 									const DVector &w    ){
 
+    ACADO_PROFILE( "integration" );
+
     int run1;
     returnValue returnvalue;
     if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
@@ -356,6 +360,8 @@ returnValue Integrator::setBackwardSeed(	const int    &order,
 
 returnValue Integrator::integrateSensitivities( ){
 
+    ACADO_PROFILE( "integrator sensitivities" );
+
     uint run1;
     returnValue returnvalue;
 
@@ -588,6 +594,7 @@ void Integrator::initializeOptions(){
 
     get( MAX_NUM_INTEGRATOR_STEPS         , maxNumberOfSteps  );
     get( INTEGRATOR_TOLERANCE  , TOL               );
+    get( ABSOLUTE_TOLERANCE    , ATOL              );
     get( INITIAL_INTEGRATOR_STEPSIZE      , hini              );
     get( MIN_INTEGRATOR_STEPSIZE          , hmin              );
     get( MAX_INTEGRATOR_STEPSIZE          , hmax              );
@@ -623,7 +630,15 @@ int Integrator::getDimX() const{
 
 returnValue Integrator::printRunTimeProfile() const{
 
-	return printLogRecord(cout, outputLoggingIdx, PRINT_LAST_ITER);
+	returnValue returnvalue = printLogRecord(cout, outputLoggingIdx, PRINT_LAST_ITER);
+
+	if ( Profiler::isEnabled() == BT_TRUE )
+	{
+		Profiler::print( cout,"integration" );
+		Profiler::print( cout,"integrator sensitivities" );
+	}
+
+	return returnvalue;
 }
 
 
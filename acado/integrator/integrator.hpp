@@ -448,7 +448,9 @@ class Integrator : public AlgorithmicBase
 
 		/** Prints the run-time profile. This routine \n
 		*  can be used after an integration run in   \n
-		*  order to assess the performance.          \n
+		*  order to assess the performance. If the    \n
+		*  Profiler is enabled, the section tree of   \n
+		*  all integrations is printed as well.       \n
 		*/
 		virtual returnValue printRunTimeProfile() const;
 
@@ -643,6 +645,7 @@ class Integrator : public AlgorithmicBase
 		double   hmax                ;  /**< the maximum step size                              */
 		double   tune                ;  /**< tuning parameter for the step size control.        */
 		double   TOL                 ;  /**< the integration tolerance                          */
+		double   ATOL                ;  /**< the absolute tolerance used for error scaling      */
 		int      las                 ;  /** the type of linear algebra solver to be used        */
 
 		Grid     timeInterval        ;  /**< the time interval                                  */
@@ -612,6 +612,7 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     tune  = 0.5      ;
     TOL   = 0.000001 ;
+    ATOL  = 0.000001 ;
 
 
     // INTERNAL INDEX LISTS:
@@ -1219,11 +1220,8 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
      // initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
     returnvalue = rhs[0].evaluate( 0, x, initialAlgebraicResiduum );
@@ -2042,11 +2040,8 @@ returnValue IntegratorBDF::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(nablaY(0,run1)) + atol/TOL;
+            diff_scale(run1) = fabs(nablaY(0,run1)) + ATOL/TOL;
 
 
      // apply a numeric stabilization of the step size control:
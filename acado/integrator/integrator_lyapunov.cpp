@@ -547,6 +547,7 @@ void IntegratorLYAPUNOV::constructAll( const IntegratorLYAPUNOV& arg ){
 
     tune  = arg.tune;
     TOL   = arg.TOL;
+    ATOL  = arg.ATOL;
 
     err_power = arg.err_power;
 
@@ -808,11 +809,8 @@ returnValue IntegratorLYAPUNOV::evaluate( const DVector &x0  ,
      // Initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
      // PRINTING:
@@ -1541,11 +1539,8 @@ returnValue IntegratorLYAPUNOV::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
 
@@ -503,6 +503,7 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
 
     tune  = arg.tune;
     TOL   = arg.TOL;
+    ATOL  = arg.ATOL;
 
     err_power = arg.err_power;
 
@@ -738,11 +739,8 @@ returnValue IntegratorRK::evaluate( const DVector &x0  ,
      // Initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
      // PRINTING:
@@ -1413,11 +1411,8 @@ returnValue IntegratorRK::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
 
@@ -181,6 +181,10 @@ class BlockMatrix
 		 *  \return BT_TRUE iff submatrix object is square. */
 		inline bool isSquare( uint rowIdx, uint colIdx ) const;
 
+		/** Tests if a specified sub-matrix has been set by setIdentity().
+		 *  \return BT_TRUE iff submatrix object is an identity block. */
+		inline bool isIdentity( uint rowIdx, uint colIdx ) const;
+
         /** Returns the a block matrix whose components are the absolute
          *  values of the components of this object.
          */
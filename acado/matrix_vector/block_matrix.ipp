@@ -159,6 +159,17 @@ inline bool BlockMatrix::isSquare( uint rowIdx, uint colIdx ) const{
 }
 
 
+
+inline bool BlockMatrix::isIdentity( uint rowIdx, uint colIdx ) const{
+
+    ASSERT( rowIdx < getNumRows( ) );
+    ASSERT( colIdx < getNumCols( ) );
+
+    if( types[rowIdx][colIdx] == SBMT_ONE ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
 inline bool BlockMatrix::isEmpty() const{
 
     if( (getNumRows() == 0) && (getNumCols() == 0) ) return BT_TRUE;
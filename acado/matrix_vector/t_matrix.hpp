@@ -34,6 +34,9 @@
 #define ACADO_TOOLKIT_T_MATRIX_HPP
 
 
+#include <new>
+
+
 BEGIN_NAMESPACE_ACADO
 
 /**
@@ -88,53 +91,66 @@ public:
    */
   //! @brief Default constructor
   Tmatrix():
-    _nr(0), _nc(0), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(0), _nc(0), _data(0), _stride(1), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {}
   //! @brief Constructor doing size assignment
   Tmatrix
     ( const unsigned int nr, const unsigned int nc=1, const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _data(0), _stride(1), _sub(!alloc),
+    _pcol(0), _prow(0), _pblock(0)
     {
+      if( !alloc ) return;
+      _allocate();
       unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      for( unsigned int ie=0; ie<ne; ie++ )
+        new( _data+ie ) T;
     }
   //! @brief Constructor doing size assignment and element initialization
   template <typename U> Tmatrix
     ( const unsigned int nr, const unsigned int nc, const U&v,
       const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _data(0), _stride(1), _sub(!alloc),
+    _pcol(0), _prow(0), _pblock(0)
     {
+      if( !alloc ) return;
+      _allocate();
       unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T(v): 0 );
-        _data.push_back( pvall );
-      }
+      for( unsigned int ie=0; ie<ne; ie++ )
+        new( _data+ie ) T(v);
     }
   //! @brief Copy Constructor
   Tmatrix
     ( const Tmatrix<T>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _data(0), _stride(1), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<T*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
-      }
+      _allocate();
+      unsigned int ne = _nr*_nc;
+      for( unsigned int ie=0; ie<ne; ie++ )
+        new( _data+ie ) T( M._val(ie) );
     }
   //! @brief Copy Constructor doing type conversion
   template <typename U> Tmatrix
     ( const Tmatrix<U>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _data(0), _stride(1), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<U*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
-      }
+      _allocate();
+      unsigned int ne = _nr*_nc;
+      for( unsigned int ie=0; ie<ne; ie++ )
+        new( _data+ie ) T( M._val(ie) );
     }
+#ifdef ACADO_HAS_CXX11
+  //! @brief Move Constructor
+  Tmatrix
+    ( Tmatrix<T>&&M ):
+    _nr(0), _nc(0), _data(0), _stride(1), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
+    {
+      _move( M );
+    }
+#endif
   //! @brief Destructor
   ~Tmatrix()
     {
@@ -153,12 +169,13 @@ public:
       delete _pblock;
       if( !_sub ) _reset();
       _nr = nr; _nc = nc; _sub = !alloc;
+      _data = 0; _stride = 1;
       _pcol = _prow = _pblock = 0;
+      if( !alloc ) return;
+      _allocate();
       unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      for( unsigned int ie=0; ie<ne; ie++ )
+        new( _data+ie ) T;
     }
   //! @brief Sets/retrieves value of column ic
   Tmatrix<T>& col
@@ -166,8 +183,8 @@ public:
   //! @brief Sets/retrieves value of row ir
   Tmatrix<T>& row
     ( const unsigned int ir );
-  //! @brief Sets/retrieves pointer to entry (ir,ic)
-  T*& pval
+  //! @brief Retrieves pointer to entry (ir,ic)
+  T* pval
     ( const unsigned int ir, const unsigned int ic );
   //! @brief Retrieves number of columns
   unsigned int col() const
@@ -180,6 +197,11 @@ public:
   //! @brief Sets the elements of a matrix from an array (columnwise storage)
   void array
     ( const T*pM );
+  //! @brief Retrieves pointer to the contiguous element storage (columnwise storage, not available for rows)
+  T* data()
+    { ASSERT( _stride==1 ); return _data; }
+  const T* data() const
+    { ASSERT( _stride==1 ); return _data; }
 
 	unsigned int getDim() const{ return _nc*_nr; }
 	unsigned int getNumRows() const{ return _nr; }
@@ -198,6 +220,10 @@ public:
     ( const unsigned int ie ) const;
   Tmatrix<T>& operator=
   ( const Tmatrix<T>&M );
+#ifdef ACADO_HAS_CXX11
+  Tmatrix<T>& operator=
+  ( Tmatrix<T>&&M );
+#endif
   Tmatrix<T>& operator=
   ( const T&m );
   template <typename U> Tmatrix<T>& operator+=
@@ -217,12 +243,17 @@ public:
 
 private:
 
+  //! @brief Maximum number of elements stored without heap allocation
+  enum{ _NSMALL = 4 };
+
   //! @brief Number of rows
   unsigned int _nr;
   //! @brief Number of columns
   unsigned int _nc;
-  //! @brief Vector of pointers to elements (column-wise storage)
-  std::vector<T*> _data;
+  //! @brief Pointer to first element (column-wise storage)
+  T* _data;
+  //! @brief Distance between two consecutive elements in _data (rows of a matrix have stride >1)
+  unsigned int _stride;
   //! @brief Flag indicating whether the current object is a submatrix
   bool _sub;
   //! @brief Pointer to Tmatrix<T> container storing column
@@ -231,6 +262,13 @@ private:
   Tmatrix<T>* _prow;
   //! @brief Pointer to Tmatrix<T> container storing blocks
   Tmatrix<T>* _pblock;
+  //! @brief Storage for small matrices, avoids heap allocation for scalars and short vectors
+  union{
+    char _buf[_NSMALL*sizeof(T)];
+    double _alignDouble;
+    long double _alignLongDouble;
+    void* _alignPointer;
+  } _small;
 
   //! @brief Returns a reference to actual value at position ie
   T& _val
@@ -242,10 +280,20 @@ private:
   const T& _val
     ( const unsigned int ie ) const;
   //! @brief Returns a pointer to actual value at position ie
-  T*& _pval
+  T* _pval
     ( const unsigned int ie );
-  //! @brief Resets the entries in vector _data
+  //! @brief Acquires uninitialized storage for _nr*_nc elements
+  void _allocate();
+  //! @brief Destroys the elements and releases their storage
   void _reset();
+  //! @brief Returns whether the elements are stored in the small buffer
+  bool _isSmall() const
+    { return _data == reinterpret_cast<const T*>( _small._buf ); }
+#ifdef ACADO_HAS_CXX11
+  //! @brief Takes over the elements of M, leaving M empty
+  void _move
+    ( Tmatrix<T>&M );
+#endif
   //! @brief Returns the number of digits of an unsigned int value
   static unsigned int _digits
     ( unsigned int n );
@@ -300,7 +348,7 @@ Tmatrix<T>::_val
 ( const unsigned int ie )
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  return _data[ie*_stride];
 }
 
 template <typename T> inline const T&
@@ -308,46 +356,82 @@ Tmatrix<T>::_val
 ( const unsigned int ie ) const
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  return _data[ie*_stride];
 }
 
-template <typename T> inline T*&
+template <typename T> inline T*
 Tmatrix<T>::pval
 ( const unsigned int ir, const unsigned int ic )
 {
   return _pval(ic*_nr+ir);
 }
 
-template <typename T> inline T*&
+template <typename T> inline T*
 Tmatrix<T>::_pval
 ( const unsigned int ie )
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return _data[ie];
+  return _data+ie*_stride;
+}
+
+template <typename T> inline void
+Tmatrix<T>::_allocate()
+{
+  unsigned int ne = _nr*_nc;
+  _stride = 1;
+  if( ne <= _NSMALL )
+    _data = reinterpret_cast<T*>( _small._buf );
+  else
+    _data = static_cast<T*>( ::operator new( ne*sizeof(T) ) );
 }
 
 template <typename T> inline void
 Tmatrix<T>::_reset()
 {
-  typename std::vector<T*>::iterator it = _data.begin();
-  for( ; it!=_data.end(); it++ ) delete *it;
+  if( !_data ) return;
+  unsigned int ne = _nr*_nc;
+  for( unsigned int ie=0; ie<ne; ie++ )
+    _data[ie].~T();
+  if( !_isSmall() )
+    ::operator delete( _data );
+  _data = 0;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline void
+Tmatrix<T>::_move
+( Tmatrix<T>&M )
+{
+  _nr = M._nr; _nc = M._nc; _sub = M._sub; _stride = M._stride;
+  if( M._sub || !M._isSmall() ){
+    _data = M._data;
+  }
+  else{
+    _allocate();
+    unsigned int ne = _nr*_nc;
+    for( unsigned int ie=0; ie<ne; ie++ ){
+      new( _data+ie ) T( std::move( M._data[ie] ) );
+      M._data[ie].~T();
+    }
+  }
+  delete M._pcol;
+  delete M._prow;
+  delete M._pblock;
+  M._pcol = M._prow = M._pblock = 0;
+  M._nr = M._nc = 0; M._data = 0; M._stride = 1; M._sub = false;
+}
+#endif
+
 template <typename T> inline Tmatrix<T>&
 Tmatrix<T>::col
 ( const unsigned int ic )
 {
   ASSERT( ic<_nc && ic>=0 );
   if( !_pcol ) _pcol = new Tmatrix<T>( _nr, 1, false );
-  for( unsigned int ir=0; ir<_nr; ir++ ){
-    _pcol->pval(ir,0) = pval(ir,ic);
-#ifdef DEBUG__MATRIX_COL
-    std::cout << ir << " , 0 : " << pval(ir,ic) << " "
-              << _pcol->pval(ir,0) << std::endl;
-#endif
-  }
+  _pcol->_data   = _pval(ic*_nr);
+  _pcol->_stride = _stride;
 #ifdef DEBUG__MATRIX_COL
-  std::cout << std::endl;
+  std::cout << "0 , " << ic << " : " << _pcol->_data << std::endl;
 #endif
   return *_pcol;
 }
@@ -358,15 +442,10 @@ Tmatrix<T>::row
 {
   ASSERT( ir<_nr && ir>=0 );
   if( !_prow ) _prow = new Tmatrix<T>( 1, _nc, false );
-  for( unsigned int ic=0; ic<_nc; ic++ ){
-    _prow->pval(0,ic) = pval(ir,ic);
+  _prow->_data   = _pval(ir);
+  _prow->_stride = _stride*_nr;
 #ifdef DEBUG__MATRIX_ROW
-    std::cout << "0 , " << ic << " : " << pval(ir,ic) << " "
-              << _prow->pval(0,ic) << std::endl;
-#endif
-  }
-#ifdef DEBUG__MATRIX_ROW
-  std::cout << std::endl;
+  std::cout << ir << " , 0 : " << _prow->_data << std::endl;
 #endif
   return *_prow;
 }
@@ -375,6 +454,7 @@ template <typename T> inline Tmatrix<T>&
 Tmatrix<T>::operator=
 ( const Tmatrix<T>&M )
 {
+  if( &M == this ) return *this;
   if( M._nr!=_nr || M._nc!=_nc )
     resize( M._nr, M._nc );
   for( unsigned int ie=0; ie!=_nr*_nc; ie++ ){
@@ -383,6 +463,24 @@ Tmatrix<T>::operator=
   return *this;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline Tmatrix<T>&
+Tmatrix<T>::operator=
+( Tmatrix<T>&&M )
+{
+  if( &M == this ) return *this;
+  // Rows and columns of another matrix keep writing through to their elements
+  if( _sub || M._sub ) return operator=( static_cast<const Tmatrix<T>&>( M ) );
+  delete _pcol;
+  delete _prow;
+  delete _pblock;
+  _pcol = _prow = _pblock = 0;
+  _reset();
+  _move( M );
+  return *this;
+}
+#endif
+
 template <typename T> inline Tmatrix<T>&
 Tmatrix<T>::operator=
 ( const T&m )
@@ -502,7 +600,10 @@ template <typename T> inline Tmatrix<T>
 operator-
 ( const Tmatrix<T>&M )
 {
-  return -M;
+  Tmatrix<T> P( M._nr, M._nc );
+  for( unsigned int ie=0; ie!=M._nr*M._nc; ie++ )
+    P(ie) = -M(ie);
+  return P;
 }
 
 template <typename T, typename U> inline Tmatrix<T>
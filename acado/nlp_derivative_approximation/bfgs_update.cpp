@@ -240,7 +240,7 @@ returnValue BFGSupdate::applyBlockDiagonalUpdate(	BlockMatrix &B,
         getSubBlockLine( nBlocks, 3*nBlocks+run1, 3, run1, B, block );
         getSubBlockLine( nBlocks, 4*nBlocks+run1, 4, run1, B, block );
 
-        applyUpdate( block, a, b );
+        applyBlockUpdate( run1, block, a, b );
 
         setSubBlockLine( nBlocks,           run1, 0, run1, B, block );
         setSubBlockLine( nBlocks,   nBlocks+run1, 1, run1, B, block );
@@ -254,6 +254,17 @@ returnValue BFGSupdate::applyBlockDiagonalUpdate(	BlockMatrix &B,
 
 
 
+returnValue BFGSupdate::applyBlockUpdate(	uint blockIdx,
+											BlockMatrix &B,
+											const BlockMatrix &x,
+											const BlockMatrix &y
+											)
+{
+	return applyUpdate( B,x,y );
+}
+
+
+
 returnValue BFGSupdate::getSubBlockLine( const int         &N     ,
                                          const int         &line1 ,
                                          const int         &line2 ,
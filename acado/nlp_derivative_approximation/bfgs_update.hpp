@@ -169,6 +169,19 @@ class BFGSupdate : public ConstantHessian
 														);
 
 
+        /** Updates the diagonal block with given index; called by         \n
+         *  applyBlockDiagonalUpdate for each block. By default, a standard \n
+         *  BFGS update (applyUpdate) is applied.                          \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        virtual returnValue applyBlockUpdate(	uint blockIdx,        /**< index of the block   */
+												BlockMatrix &B,       /**< block to be updated  */
+												const BlockMatrix &x, /**< direction x          */
+												const BlockMatrix &y  /**< residuum             */
+												);
+
+
 
         returnValue getSubBlockLine( const int         &N     ,
                                      const int         &line1 ,
@@ -201,6 +214,8 @@ CLOSE_NAMESPACE_ACADO
 
 #include <acado/nlp_derivative_approximation/bfgs_update.ipp>
 
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp>
+
 
 #endif  // ACADO_TOOLKIT_BFGS_UPDATE_HPP
 
@@ -0,0 +1,311 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/nlp_derivative_approximation/limited_memory_bfgs_update.cpp
+ */
+
+
+
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate( ) : BFGSupdate( )
+{
+	memorySize = 10;
+}
+
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate(	UserInteraction* _userInteraction,
+													uint _nBlocks,
+													uint _memorySize
+													) : BFGSupdate( _userInteraction,_nBlocks )
+{
+	memorySize = _memorySize;
+	if ( memorySize == 0 )
+		memorySize = 1;
+}
+
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate( const LimitedMemoryBFGSupdate& rhs ) : BFGSupdate( rhs )
+{
+	memorySize = rhs.memorySize;
+	sMemory    = rhs.sMemory;
+	yMemory    = rhs.yMemory;
+}
+
+
+LimitedMemoryBFGSupdate::~LimitedMemoryBFGSupdate( )
+{
+}
+
+
+LimitedMemoryBFGSupdate& LimitedMemoryBFGSupdate::operator=( const LimitedMemoryBFGSupdate& rhs )
+{
+	if ( this != &rhs )
+	{
+		BFGSupdate::operator=( rhs );
+
+		memorySize = rhs.memorySize;
+		sMemory    = rhs.sMemory;
+		yMemory    = rhs.yMemory;
+	}
+
+	return *this;
+}
+
+
+NLPderivativeApproximation* LimitedMemoryBFGSupdate::clone( ) const
+{
+	return new LimitedMemoryBFGSupdate( *this );
+}
+
+
+
+returnValue LimitedMemoryBFGSupdate::initHessian(	BlockMatrix& B,
+													uint N,
+													const OCPiterate& iter
+													)
+{
+	uint nMemories = nBlocks;
+	if ( nMemories == 0 )
+		nMemories = 1;
+
+	sMemory.clear( );
+	yMemory.clear( );
+	sMemory.resize( nMemories );
+	yMemory.resize( nMemories );
+
+	return BFGSupdate::initHessian( B,N,iter );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue LimitedMemoryBFGSupdate::applyUpdate(	BlockMatrix &B,
+													const BlockMatrix &x,
+													const BlockMatrix &y
+													)
+{
+	return applyBlockUpdate( 0,B,x,y );
+}
+
+
+returnValue LimitedMemoryBFGSupdate::applyBlockUpdate(	uint blockIdx,
+														BlockMatrix &B,
+														const BlockMatrix &x,
+														const BlockMatrix &y
+														)
+{
+    // CONSTANTS FOR POWELL'S STRATEGY (cf. BFGSupdate::applyUpdate):
+    // --------------------------------------------------------------
+    const double epsilon        = 0.2;
+    const double regularisation = 100.0*EPS;
+
+    uint run1, run2;
+    DMatrix tmp;
+
+    if ( blockIdx >= sMemory.size( ) )
+    {
+        sMemory.resize( blockIdx+1 );
+        yMemory.resize( blockIdx+1 );
+    }
+
+
+    // DETERMINE THE DIMENSIONS OF THE COMPONENTS:
+    // -------------------------------------------
+    uint nComponents = x.getNumRows( );
+    std::vector<uint> dims   ( nComponents,0 );
+    std::vector<uint> offsets( nComponents,0 );
+    uint n = 0;
+
+    for( run1 = 0; run1 < nComponents; ++run1 )
+    {
+        x.getSubBlock( run1,0,tmp );
+        dims   [run1] = tmp.getNumRows( );
+        offsets[run1] = n;
+        n += dims[run1];
+    }
+
+    if ( n == 0 )
+        return SUCCESSFUL_RETURN;
+
+
+    // STACK THE BLOCKS INTO DENSE MATRICES:
+    // -------------------------------------
+    DVector s( n ), z( n );
+    DMatrix Bk( n,n );
+
+    for( run1 = 0; run1 < nComponents; ++run1 )
+    {
+        if ( dims[run1] == 0 )
+            continue;
+
+        x.getSubBlock( run1,0,tmp );
+        s.segment( offsets[run1],dims[run1] ) = tmp.col( 0 );
+
+        y.getSubBlock( run1,0,tmp );
+        if ( tmp.getNumRows( ) == dims[run1] )
+            z.segment( offsets[run1],dims[run1] ) = tmp.col( 0 );
+
+        for( run2 = 0; run2 < nComponents; ++run2 )
+        {
+            if ( dims[run2] == 0 )
+                continue;
+
+            B.getSubBlock( run1,run2,tmp );
+            if ( ( tmp.getNumRows( ) == dims[run1] ) && ( tmp.getNumCols( ) == dims[run2] ) )
+                Bk.block( offsets[run1],offsets[run2],dims[run1],dims[run2] ) = tmp;
+        }
+    }
+
+
+    // CURVATURE CHECK:
+    // ----------------
+    DVector Bs  = Bk*s;
+    double  sBs = s.dot( Bs );
+    double  sz  = s.dot( z  );
+
+    if( sz <= epsilon*sBs )
+    {
+        switch( modification )
+        {
+            case MOD_NO_MODIFICATION:
+                 break;
+
+            case MOD_NOCEDALS_MODIFICATION:
+                 return SUCCESSFUL_RETURN;
+
+            case MOD_POWELLS_MODIFICATION:
+                 {
+                     double theta = (1.0-epsilon)*sBs/(sBs-sz+regularisation);
+                     z  = theta*z + (1.0-theta)*Bs;
+                     sz = s.dot( z );
+                 }
+                 break;
+        }
+    }
+
+    // the compact representation requires positive curvature:
+    if( sz <= regularisation )
+        return SUCCESSFUL_RETURN;
+
+
+    // STORE THE CURVATURE PAIR:
+    // -------------------------
+    std::deque<DVector>& S_ = sMemory[blockIdx];
+    std::deque<DVector>& Y_ = yMemory[blockIdx];
+
+    if ( ( S_.empty( ) == false ) && ( S_.back( ).getDim( ) != n ) )
+    {
+        S_.clear( );
+        Y_.clear( );
+    }
+
+    S_.push_back( s );
+    Y_.push_back( z );
+
+    while( S_.size( ) > memorySize )
+    {
+        S_.pop_front( );
+        Y_.pop_front( );
+    }
+
+
+    // REBUILD THE BLOCK FROM THE COMPACT REPRESENTATION:
+    // --------------------------------------------------
+    uint k = S_.size( );
+
+    DMatrix S( n,k ), Y( n,k );
+    for( run1 = 0; run1 < k; ++run1 )
+    {
+        S.col( run1 ) = S_[run1];
+        Y.col( run1 ) = Y_[run1];
+    }
+
+    double delta = z.dot( z ) / sz;
+
+    DMatrix SY = S.transpose()*Y;
+    DMatrix M( 2*k,2*k );
+
+    M.block( 0,0,k,k ) = delta*S.transpose()*S;
+    for( run1 = 0; run1 < k; ++run1 )
+    {
+        for( run2 = 0; run2 < run1; ++run2 )
+        {
+            M( run1,k+run2 ) = SY( run1,run2 );
+            M( k+run2,run1 ) = SY( run1,run2 );
+        }
+        M( k+run1,k+run1 ) = -SY( run1,run1 );
+    }
+
+    DMatrix W( n,2*k );
+    W.block( 0,0,n,k ) = delta*S;
+    W.block( 0,k,n,k ) = Y;
+
+    DMatrix MinvWt = M.partialPivLu( ).solve( W.transpose() );
+
+    Bk = -W*MinvWt;
+    for( run1 = 0; run1 < n; ++run1 )
+        Bk( run1,run1 ) += delta;
+
+
+    // WRITE THE RESULT BACK:
+    // ----------------------
+    for( run1 = 0; run1 < nComponents; ++run1 )
+    {
+        if ( dims[run1] == 0 )
+            continue;
+
+        for( run2 = 0; run2 < nComponents; ++run2 )
+        {
+            if ( dims[run2] == 0 )
+                continue;
+
+            tmp = Bk.block( offsets[run1],offsets[run2],dims[run1],dims[run2] );
+            B.setDense( run1,run2,tmp );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,163 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+#define ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/nlp_derivative_approximation/bfgs_update.hpp>
+
+#include <deque>
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Implements limited-memory BFGS updates for approximating second-order derivatives within NLPsolvers.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class LimitedMemoryBFGSupdate implements limited-memory BFGS (L-BFGS)
+ *	updates for approximating second-order derivative information within
+ *	iterative NLPsolvers.
+ *
+ *	Instead of accumulating updates in the Hessian approximation, only the
+ *	last curvature pairs (s,y) of each block are stored. After each step, the
+ *	Hessian blocks are rebuilt from the compact representation
+ *
+ *	B = delta*I - W*M^{-1}*W^T,  W = [ delta*S, Y ],
+ *	M = [ delta*S^T*S, L; L^T, -D ],
+ *
+ *	where D and L denote the diagonal and the strictly lower triangular part
+ *	of S^T*Y, respectively. When performing block updates, each shooting
+ *	interval keeps its own memory, such that the block structure of the
+ *	Hessian is preserved.
+ */
+class LimitedMemoryBFGSupdate : public BFGSupdate
+{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        LimitedMemoryBFGSupdate( );
+
+        /** Constructor that takes the number of blocks for matrix block updates
+		 *	and the number of curvature pairs to be stored per block. */
+        LimitedMemoryBFGSupdate(	UserInteraction* _userInteraction,
+									uint _nBlocks = 0,
+									uint _memorySize = 10
+									);
+
+        /** Copy constructor (deep copy). */
+        LimitedMemoryBFGSupdate( const LimitedMemoryBFGSupdate& rhs );
+
+        /** Destructor. */
+        virtual ~LimitedMemoryBFGSupdate( );
+
+        /** Assignment operator (deep copy). */
+        LimitedMemoryBFGSupdate& operator=( const LimitedMemoryBFGSupdate& rhs );
+
+		virtual NLPderivativeApproximation* clone( ) const;
+
+
+
+        virtual returnValue initHessian(	BlockMatrix& B, 	    /**< matrix to be initialised */
+											uint N,                 /**< number of intervals      */
+											const OCPiterate& iter  /**< current iterate          */
+											);
+
+
+        /** Returns the number of curvature pairs stored per block.   \n
+         *                                                            \n
+         *  \return number of curvature pairs                         \n
+         */
+        inline uint getMemorySize( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Applies a limited-memory BFGS update to the full matrix.  \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        virtual returnValue applyUpdate(	BlockMatrix &B, /**< matrix to be updated */
+											const BlockMatrix &x, /**< direction x          */
+											const BlockMatrix &y  /**< residuum             */
+											);
+
+
+        /** Stores the curvature pair (x,y) of the block with given index \n
+         *  and rebuilds the block from the compact representation.       \n
+         *  The curvature condition is enforced as in applyUpdate of      \n
+         *  the BFGSupdate; pairs without positive curvature are skipped. \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         */
+        virtual returnValue applyBlockUpdate(	uint blockIdx,        /**< index of the block   */
+												BlockMatrix &B,       /**< block to be updated  */
+												const BlockMatrix &x, /**< direction x          */
+												const BlockMatrix &y  /**< residuum             */
+												);
+
+
+    //
+    // PROTECTED DATA MEMBERS:
+    //
+    protected:
+
+		uint memorySize;
+
+		std::vector< std::deque<DVector> > sMemory;		/**< Stored steps, per block.              */
+		std::vector< std::deque<DVector> > yMemory;		/**< Stored gradient differences, per block. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.ipp>
+
+
+#endif  // ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+
+/*
+ *  end of file
+ */
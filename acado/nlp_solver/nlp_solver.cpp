@@ -225,6 +225,7 @@ returnValue NLPsolver::setupOptions( )
 	addOption( PRINT_COPYRIGHT             , defaultPrintCopyright          );
 	addOption( HESSIAN_APPROXIMATION       , defaultHessianApproximation    );
 	addOption( DYNAMIC_HESSIAN_APPROXIMATION, defaultDynamicHessianApproximation );
+	addOption( LBFGS_MEMORY_SIZE           , defaultLBFGSmemorySize         );
 	addOption( DYNAMIC_SENSITIVITY         , defaultDynamicSensitivity      );
 	addOption( OBJECTIVE_SENSITIVITY       , defaultObjectiveSensitivity    );
 	addOption( CONSTRAINT_SENSITIVITY      , defaultConstraintSensitivity   );
@@ -32,6 +32,7 @@
 
 
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/clock/profiler.hpp>
 #include <iomanip>
 #include <iostream>
 
@@ -296,6 +297,8 @@ returnValue SCPmethod::step(	const DVector& x0_,
 								const DVector& p_
 								)
 {
+	ACADO_PROFILE( "SQP iteration" );
+
 	if ( numberOfSteps == 0 )
 		replot( PLOT_AT_START );
 
@@ -318,7 +321,8 @@ returnValue SCPmethod::feedbackStep(	const DVector& x0_,
 										const DVector& p_
 										)
 {
-  
+	ACADO_PROFILE( "feedback step" );
+
   #ifdef SIM_DEBUG
   printf("START OF THE FEEDBACK STEP \n");
   
@@ -383,6 +387,8 @@ returnValue SCPmethod::feedbackStep(	const DVector& x0_,
 
 returnValue SCPmethod::performCurrentStep( )
 {
+	ACADO_PROFILE( "globalization" );
+
 	returnValue returnvalue;
 
 	if ( isInRealTimeMode == BT_TRUE )
@@ -455,6 +461,8 @@ returnValue SCPmethod::performCurrentStep( )
 
 returnValue SCPmethod::prepareNextStep( )
 {
+	ACADO_PROFILE( "preparation step" );
+
     returnValue returnvalue;
     RealClock clockLG;
 
@@ -622,7 +630,12 @@ returnValue SCPmethod::getVarianceCovariance( DMatrix &var )
 
 returnValue SCPmethod::printRuntimeProfile() const
 {
-	return printLogRecord(cout, timeLoggingIdx, PRINT_LAST_ITER);
+	returnValue returnvalue = printLogRecord(cout, timeLoggingIdx, PRINT_LAST_ITER);
+
+	if ( Profiler::isEnabled() == BT_TRUE )
+		Profiler::print( cout );
+
+	return returnvalue;
 }
 
 
@@ -768,6 +781,11 @@ returnValue SCPmethod::setup( )
         }
     }
 
+	int memorySize;
+	get( LBFGS_MEMORY_SIZE,memorySize );
+	if ( memorySize < 1 )
+		return ACADOERROR( RET_INVALID_OPTION );
+
 	if ( derivativeApproximation != 0 )
 		delete derivativeApproximation;
 
@@ -789,6 +807,10 @@ returnValue SCPmethod::setup( )
 			derivativeApproximation = new BFGSupdate( userInteraction,getNumPoints() );
 			break;
 
+		case L_BFGS_UPDATE:
+			derivativeApproximation = new LimitedMemoryBFGSupdate( userInteraction,getNumPoints(),memorySize );
+			break;
+
 		case GAUSS_NEWTON:
 			derivativeApproximation = new GaussNewtonApproximation( userInteraction );
 			break;
@@ -161,7 +161,9 @@ class SCPmethod : public NLPsolver
 
         /** Prints the run-time profile. This routine \n
          *  can be used after an integration run in   \n
-         *  order to assess the performance.          \n
+         *  order to assess the performance. If the    \n
+         *  Profiler is enabled, its section tree is  \n
+         *  printed as well.                          \n
          */
         virtual returnValue printRuntimeProfile() const;
 
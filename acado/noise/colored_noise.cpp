@@ -116,10 +116,11 @@ returnValue ColoredNoise::setDynamicSystem(	const DynamicSystem& _dynamicSystem
 
 
 
-returnValue ColoredNoise::init(	uint seed
+returnValue ColoredNoise::init(	uint _seed
 								)
 {
 	w.setZero( );
+	setSeed( _seed );
 
 	setStatus( BS_READY );
 	return SUCCESSFUL_RETURN;
@@ -115,15 +115,16 @@ class ColoredNoise : public Noise
 		/** Initializes noise generation and performs a couple of consistency checks.
 		 *	Initialization of the pseudo-random number generator can be based on
 		 *	a seed in order to allow exact reproduction of generated noise. If seed
-		 *	is not specified (i.e. 0), a seed is obtain from the system clock.
+		 *	is not specified (i.e. 0), the seed assigned at a previous initialization
+		 *	is kept; if there is none, a seed is obtained from the system clock.
 		 *
-		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *	@param[in] _seed	Seed for pseudo-random number generator.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
 		 *	        RET_INVALID_NOISE_SETTINGS, \n
 		 *	        RET_NO_NOISE_SETTINGS
 		 */
-		virtual returnValue init(	uint seed = 0
+		virtual returnValue init(	uint _seed = 0
 									);
 	
 		/** Generates a single noise vector based on current internal settings.
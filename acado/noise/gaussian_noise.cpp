@@ -32,8 +32,6 @@
 
 #include <acado/noise/gaussian_noise.hpp>
 
-#include <stdlib.h>
-#include <time.h>
 
 
 
@@ -121,6 +119,7 @@ GaussianNoise* GaussianNoise::clone(	uint idx
 	GaussianNoise tmp( DVector(1),DVector(1) );
 	tmp.Noise::operator=( *this );
 	tmp.w.init( 1,1 );
+	tmp.componentOffset = componentOffset + idx;
 	tmp.mean(0)     = mean(idx);
 	tmp.variance(0) = variance(idx);
 
@@ -129,7 +128,7 @@ GaussianNoise* GaussianNoise::clone(	uint idx
 
 
 
-returnValue GaussianNoise::init(	uint seed
+returnValue GaussianNoise::init(	uint _seed
 									)
 {
 	if ( mean.getDim( ) != variance.getDim( ) )
@@ -139,10 +138,7 @@ returnValue GaussianNoise::init(	uint seed
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
 	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	setSeed( _seed );
 
 	setStatus( BS_READY );
 
@@ -160,10 +156,15 @@ returnValue GaussianNoise::step(	DVector& _w
 		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
 	if ( w.getNumPoints( ) != 1 )
-		w.init( 1,getDim() );
+		w.init( getDim(),1 );
 
+	double value;
 	for( uint j=0; j<getDim( ); ++j )
-		w(0,j) = getGaussianRandomNumber( mean(j),variance(j) );
+	{
+		getGaussianRandomNumbers( j,position,1,&value );
+		w(0,j) = mean(j) + sqrt( variance(j) ) * value;
+	}
+	++position;
 
 	_w = w.getVector( 0 );
 
@@ -183,9 +184,19 @@ returnValue GaussianNoise::step(	VariablesGrid& _w
 	if ( w.getNumPoints( ) != _w.getNumPoints( ) )
 		w.init( getDim(),_w.getNumPoints( ) );
 
-	for( uint i=0; i<_w.getNumPoints( ); ++i )
-		for( uint j=0; j<getDim( ); ++j )
-			w(i,j) = getGaussianRandomNumber( mean(j),variance(j) );
+	uint nPoints = _w.getNumPoints( );
+	std::vector< double > values( nPoints );
+
+	for( uint j=0; j<getDim( ); ++j )
+	{
+		if ( nPoints > 0 )
+			getGaussianRandomNumbers( j,position,nPoints,&values[0] );
+
+		double stdDeviation = sqrt( variance(j) );
+		for( uint i=0; i<nPoints; ++i )
+			w(i,j) = mean(j) + stdDeviation * values[i];
+	}
+	position += nPoints;
 
 	_w = w;
 
@@ -197,28 +208,6 @@ returnValue GaussianNoise::step(	VariablesGrid& _w
 // PROTECTED MEMBER FUNCTIONS:
 //
 
-double GaussianNoise::getGaussianRandomNumber(	double _mean,
-												double _variance
-												) const
-{
-	// Box-Muller method
-	double norm = 2.0;
-	double uniformRandomNumber1, uniformRandomNumber2;
-
-	while ( norm >= 1.0 )
-	{
-		uniformRandomNumber1 = getUniformRandomNumber( -1.0,1.0 );
-		uniformRandomNumber2 = getUniformRandomNumber( -1.0,1.0 );
-		norm = uniformRandomNumber1*uniformRandomNumber1 + uniformRandomNumber2*uniformRandomNumber2;
-	}
-   
-	double gaussianRandomNumber1 = sqrt( -2.0 * log(norm)/norm ) * uniformRandomNumber1;
-	double gaussianRandomNumber2 = sqrt( -2.0 * log(norm)/norm ) * uniformRandomNumber2;
-
-	return _mean + sqrt( _variance ) * (gaussianRandomNumber1+gaussianRandomNumber2)/2.0;
-}
-
-
 
 
 CLOSE_NAMESPACE_ACADO
@@ -32,19 +32,70 @@
 
 #include <acado/noise/noise.hpp>
 
+#include <time.h>
+
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+//
+// Philox4x32-10 counter-based generator, see Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC'11.
+//
+
+static inline void philox4x32(	uint32_t ctr[ 4 ],
+								uint32_t key0,
+								uint32_t key1
+								)
+{
+	const uint32_t M0 = 0xD2511F53;
+	const uint32_t M1 = 0xCD9E8D57;
+
+	for( uint r = 0; r < 10; ++r )
+	{
+		uint64_t p0 = (uint64_t)M0 * ctr[ 0 ];
+		uint64_t p1 = (uint64_t)M1 * ctr[ 2 ];
+
+		uint32_t x0 = (uint32_t)(p1 >> 32) ^ ctr[ 1 ] ^ key0;
+		uint32_t x2 = (uint32_t)(p0 >> 32) ^ ctr[ 3 ] ^ key1;
+
+		ctr[ 0 ] = x0;
+		ctr[ 1 ] = (uint32_t)p1;
+		ctr[ 2 ] = x2;
+		ctr[ 3 ] = (uint32_t)p0;
+
+		key0 += 0x9E3779B9;
+		key1 += 0xBB67AE85;
+	}
+}
+
+/* Uniform number in [0,1) with 53 random bits. */
+static inline double toUniform(	uint32_t a,
+								uint32_t b
+								)
+{
+	return ((double)(a >> 5) * 67108864.0 + (double)(b >> 6)) * (1.0 / 9007199254740992.0);
+}
+
+
 Noise::Noise( )
 {
+	seed = 0;
+	streamId = 0;
+	componentOffset = 0;
+	position = 0;
 }
 
 
 Noise::Noise( const Noise& rhs )
 {
 	w = rhs.w;
+
+	seed = rhs.seed;
+	streamId = rhs.streamId;
+	componentOffset = rhs.componentOffset;
+	position = rhs.position;
 }
 
 
@@ -58,12 +109,125 @@ Noise& Noise::operator=( const Noise& rhs )
 	if ( this != &rhs )
 	{
 		w = rhs.w;
+
+		seed = rhs.seed;
+		streamId = rhs.streamId;
+		componentOffset = rhs.componentOffset;
+		position = rhs.position;
 	}
 
     return *this;
 }
 
 
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue Noise::setSeed(	uint _seed
+							)
+{
+	if ( _seed != 0 )
+		seed = _seed;
+	else if ( seed == 0 )
+		seed = (uint)time( 0 );
+
+	position = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void Noise::getUniformRandomNumbers(	uint component,
+										uint64_t _position,
+										uint n,
+										double* values
+										) const
+{
+	// Each counter value yields two numbers of the stream
+	uint64_t block = _position / 2;
+	uint half = (uint)(_position % 2);
+	uint32_t x[ 4 ];
+
+	uint i = 0;
+	while ( i < n )
+	{
+		x[ 0 ] = (uint32_t)block;
+		x[ 1 ] = (uint32_t)(block >> 32);
+		x[ 2 ] = componentOffset + component;
+		x[ 3 ] = 0;
+		philox4x32( x, seed, streamId );
+
+		for( ; ( half < 2 ) && ( i < n ); ++half, ++i )
+			values[ i ] = toUniform( x[ 2 * half ], x[ 2 * half + 1 ] );
+
+		half = 0;
+		++block;
+	}
+}
+
+
+void Noise::getGaussianRandomNumbers(	uint component,
+										uint64_t _position,
+										uint n,
+										double* values
+										) const
+{
+	// Numbers are generated in chunks of a fixed number of blocks, each
+	// block yielding a pair of numbers; this avoids any memory allocation,
+	// in particular when single numbers are drawn point-wise
+	const uint chunkSize = 32;
+	double radius[ chunkSize ];
+	double angle[ chunkSize ];
+
+	uint64_t block = _position / 2;
+	uint half = (uint)(_position % 2);
+	uint32_t x[ 4 ];
+
+	uint i = 0;
+	while ( i < n )
+	{
+		uint nBlocks = ( half + ( n - i ) + 1 ) / 2;
+		if ( nBlocks > chunkSize )
+			nBlocks = chunkSize;
+
+		for( uint b = 0; b < nBlocks; ++b )
+		{
+			x[ 0 ] = (uint32_t)(block + b);
+			x[ 1 ] = (uint32_t)((block + b) >> 32);
+			x[ 2 ] = componentOffset + component;
+			x[ 3 ] = 0;
+			philox4x32( x, seed, streamId );
+
+			radius[ b ] = 1.0 - toUniform( x[ 0 ], x[ 1 ] );
+			angle[ b ]  = toUniform( x[ 2 ], x[ 3 ] );
+		}
+
+		// Box-Muller transformation
+		for( uint b = 0; b < nBlocks; ++b )
+		{
+			radius[ b ] = sqrt( -2.0 * log( radius[ b ] ) );
+			angle[ b ] *= 2.0 * M_PI;
+		}
+
+		for( uint b = 0; b < nBlocks; ++b )
+		{
+			for( ; ( half < 2 ) && ( i < n ); ++half, ++i )
+			{
+				if ( half == 0 )
+					values[ i ] = radius[ b ] * cos( angle[ b ] );
+				else
+					values[ i ] = radius[ b ] * sin( angle[ b ] );
+			}
+			half = 0;
+		}
+
+		block += nBlocks;
+	}
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
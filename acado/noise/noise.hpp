@@ -39,6 +39,8 @@
 #include <acado/matrix_vector/matrix_vector.hpp>
 #include <acado/variables_grid/variables_grid.hpp>
 
+#include <stdint.h>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -51,6 +53,13 @@ BEGIN_NAMESPACE_ACADO
  *  The class Noise serves as base class for generating pseudo-random noise
  *	for simulating the Process within the SimulationEnvironment.
  *
+ *	Random numbers are obtained from a counter-based generator (Philox4x32-10):
+ *	the value drawn at a given position of a noise component only depends on the
+ *	seed, the stream identifier, the component index and the position. Noise
+ *	blocks can therefore be used in parallel simulations, each with its own
+ *	stream, and the generated noise does not depend on the number of threads
+ *	nor on whether it is generated point-wise or for a whole grid at once.
+ *
  *	 \author Hans Joachim Ferreau, Boris Houska
  */
 class Noise
@@ -101,15 +110,16 @@ class Noise
 		/** Initializes noise generation and performs a couple of consistency checks.
 		 *	Initialization of the pseudo-random number generator can be based on
 		 *	a seed in order to allow exact reproduction of generated noise. If seed
-		 *	is not specified (i.e. 0), a seed is obtain from the system clock.
+		 *	is not specified (i.e. 0), the seed assigned at a previous initialization
+		 *	is kept; if there is none, a seed is obtained from the system clock.
 		 *
-		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *	@param[in] _seed	Seed for pseudo-random number generator.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
 		 *	        RET_INVALID_NOISE_SETTINGS, \n
 		 *	        RET_NO_NOISE_SETTINGS
 		 */
-		virtual returnValue init(	uint seed = 0
+		virtual returnValue init(	uint _seed = 0
 									) = 0;
 
 		/** Generates a single noise vector based on current internal settings.
@@ -157,6 +167,23 @@ class Noise
 		inline BlockStatus getStatus( ) const;
 
 
+		/** Assigns the identifier of the random number stream. Noise blocks with
+		 *	the same seed but different stream identifiers generate independent noise.
+		 *
+		 *	@param[in] _streamId	New stream identifier.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue setStreamId(	uint _streamId
+										);
+
+		/** Returns the identifier of the random number stream.
+		 *
+		 *  \return Stream identifier
+		 */
+		inline uint getStreamId( ) const;
+
+
 
 	//
 	//  PROTECTED MEMBER FUNCTIONS:
@@ -172,17 +199,47 @@ class Noise
 		inline returnValue setStatus(	BlockStatus _status
 										);
 
-		/** Returns a pseudo-random number based on a uniform distribution with
-		 *	given lower and upper limits.
+		/** Assigns the seed of the pseudo-random number generator and resets
+		 *	the position within the random number streams. If seed is 0, the seed
+		 *	assigned before is kept; if there is none, a seed is obtained from the
+		 *	system clock.
 		 *
-		 *	@param[in] _lowerLimit		Lower limit of random variable.
-		 *	@param[in] _upperLimit		Lower limit of random variable.
+		 *	@param[in] _seed	Seed for pseudo-random number generator.
 		 *
-		 *  \return Uniformly distributed pseudo-random number
+		 *  \return SUCCESSFUL_RETURN
 		 */
-		inline double getUniformRandomNumber(	double _lowerLimit,
-												double _upperLimit
-												) const;
+		returnValue setSeed(	uint _seed
+								);
+
+		/** Fills an array with pseudo-random numbers uniformly distributed in [0,1),
+		 *	drawn from the stream of the given noise component starting at the given position.
+		 *
+		 *	@param[in]  component	Index of the noise component.
+		 *	@param[in]  _position	Position of the first number within the stream.
+		 *	@param[in]  n			Number of random numbers.
+		 *	@param[out] values		Array of length n.
+		 */
+		void getUniformRandomNumbers(	uint component,
+										uint64_t _position,
+										uint n,
+										double* values
+										) const;
+
+		/** Fills an array with standard normally distributed pseudo-random numbers,
+		 *	drawn from the stream of the given noise component starting at the given position.
+		 *	Uniform numbers are generated block-wise and transformed by the Box-Muller
+		 *	method in a separate loop over the whole array.
+		 *
+		 *	@param[in]  component	Index of the noise component.
+		 *	@param[in]  _position	Position of the first number within the stream.
+		 *	@param[in]  n			Number of random numbers.
+		 *	@param[out] values		Array of length n.
+		 */
+		void getGaussianRandomNumbers(	uint component,
+										uint64_t _position,
+										uint n,
+										double* values
+										) const;
 
 
 	//
@@ -192,6 +249,11 @@ class Noise
 		BlockStatus status;				/**< Current status of the noise. */
 
 		VariablesGrid w;				/**< Sequence of most recently generated noise. */
+
+		uint seed;						/**< Seed of the pseudo-random number generator. */
+		uint streamId;					/**< Identifier of the random number stream. */
+		uint componentOffset;			/**< Index of the first noise component, non-zero for clones of single components. */
+		uint64_t position;				/**< Number of noise vectors generated since initialization. */
 };
 
 
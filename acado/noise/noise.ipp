@@ -60,35 +60,33 @@ inline BlockStatus Noise::getStatus( ) const
 }
 
 
-//
-// PROTECTED MEMBER FUNCTIONS:
-//
-
-inline returnValue Noise::setStatus(	BlockStatus _status
+inline returnValue Noise::setStreamId(	uint _streamId
 										)
 {
-	status = _status;
+	streamId = _streamId;
 	return SUCCESSFUL_RETURN;
 }
 
 
-
-inline double Noise::getUniformRandomNumber(	double _lowerLimit,
-												double _upperLimit
-												) const
+inline uint Noise::getStreamId( ) const
 {
-	double halfAmplitude = ( _upperLimit - _lowerLimit ) / 2.0;
+	return streamId;
+}
 
-	/* Random number between -RAND_MAX and RAND_MAX */
-	int randomNumber = ( rand( ) - RAND_MAX/2 ) * 2;
 
-	/* Random number between -1 and 1 */
-	double scaledRandomNumber = ((double) randomNumber) / ((double) RAND_MAX);
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
 
-	return ( halfAmplitude*scaledRandomNumber + _lowerLimit+halfAmplitude );
+inline returnValue Noise::setStatus(	BlockStatus _status
+										)
+{
+	status = _status;
+	return SUCCESSFUL_RETURN;
 }
 
 
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
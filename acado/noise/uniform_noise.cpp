@@ -32,8 +32,6 @@
 
 #include <acado/noise/uniform_noise.hpp>
 
-#include <stdlib.h>
-#include <time.h>
 
 
 
@@ -120,6 +118,7 @@ UniformNoise* UniformNoise::clone(	uint idx
 	UniformNoise tmp( DVector(1),DVector(1) );
 	tmp.Noise::operator=( *this );
 	tmp.w.init( 1,1 );
+	tmp.componentOffset = componentOffset + idx;
 	tmp.lowerLimit(0) = lowerLimit(idx);
 	tmp.upperLimit(0) = upperLimit(idx);
 
@@ -185,7 +184,7 @@ returnValue UniformNoise::setLimit(	uint idx,
 
 
 
-returnValue UniformNoise::init(	uint seed
+returnValue UniformNoise::init(	uint _seed
 								)
 {
 	if ( lowerLimit.getDim( ) != upperLimit.getDim( ) )
@@ -195,10 +194,7 @@ returnValue UniformNoise::init(	uint seed
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
 	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	setSeed( _seed );
 
 	setStatus( BS_READY );
 
@@ -216,10 +212,15 @@ returnValue UniformNoise::step(	DVector& _w
 		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
 	if ( w.getNumPoints( ) != 1 )
-		w.init( 1,getDim() );
+		w.init( getDim(),1 );
 
+	double value;
 	for( uint j=0; j<getDim( ); ++j )
-		w(0,j) = getUniformRandomNumber( lowerLimit(j),upperLimit(j) );
+	{
+		getUniformRandomNumbers( j,position,1,&value );
+		w(0,j) = lowerLimit(j) + ( upperLimit(j)-lowerLimit(j) ) * value;
+	}
+	++position;
 
 	_w = w.getVector( 0 );
 
@@ -239,9 +240,18 @@ returnValue UniformNoise::step(	VariablesGrid& _w
 	if ( w.getNumPoints( ) != _w.getNumPoints( ) )
 		w.init( getDim(),_w.getNumPoints( ) );
 
-	for( uint i=0; i<_w.getNumPoints( ); ++i )
-		for( uint j=0; j<getDim( ); ++j )
-			w(i,j) = getUniformRandomNumber( lowerLimit(j),upperLimit(j) );
+	uint nPoints = _w.getNumPoints( );
+	std::vector< double > values( nPoints );
+
+	for( uint j=0; j<getDim( ); ++j )
+	{
+		if ( nPoints > 0 )
+			getUniformRandomNumbers( j,position,nPoints,&values[0] );
+
+		for( uint i=0; i<nPoints; ++i )
+			w(i,j) = lowerLimit(j) + ( upperLimit(j)-lowerLimit(j) ) * values[i];
+	}
+	position += nPoints;
 
 	_w = w;
 
@@ -152,7 +152,6 @@ returnValue LSQEndTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        double *bseed   = new double [nh];
         double **J      = new double*[nh];
 
         for( run2 = 0; run2 < nh; run2++ )
@@ -177,15 +176,9 @@ returnValue LSQEndTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
         Du .setZero();
         Dw .setZero();
 
-        for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+        ACADO_TRY( computeCompressedBackwardSensitivities( 0, J ) );
 
         for( run2 = 0; run2 < nh; run2++ ){
-             for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                 J[run2][run3] = 0.0;
-
-             bseed[run2] = 1.0;
-             fcn.AD_backward( 0, bseed, J[run2] );
-             bseed[run2] = 0.0;
 
              for( run3 = 0; run3 < nx; run3++ ){
                   Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run2];
@@ -266,7 +259,6 @@ returnValue LSQEndTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
         for( run2 = 0; run2 < nh; run2++ )
             delete[] J[run2];
         delete[] J;
-        delete[] bseed;
         return SUCCESSFUL_RETURN;
     }
 
@@ -472,15 +472,10 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
                 delete[] fseed;
             }
 
-            for( run2 = 0; run2 < nh; run2++ ){
+            if( fcn.ADisSupported() == BT_TRUE )
+                ACADO_TRY( computeCompressedBackwardSensitivities( run1, J ) );
 
-                 if( fcn.ADisSupported() == BT_TRUE ){
-                     for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                         J[run2][run3] = 0.0;
-                     bseed[run2] = 1.0;
-                     fcn.AD_backward( run1, bseed, J[run2] );
-                     bseed[run2] = 0.0;
-                 }
+            for( run2 = 0; run2 < nh; run2++ ){
 
                  for( run3 = 0; run3 < nx; run3++ ){
                       Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
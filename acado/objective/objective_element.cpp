@@ -152,6 +152,10 @@ ObjectiveElement::ObjectiveElement( const ObjectiveElement& rhs ){
     obj       = rhs.obj      ;
     dForward  = rhs.dForward ;
     dBackward = rhs.dBackward;
+
+    rowCompression          = rhs.rowCompression;
+    nonlinearRowCompression = rhs.nonlinearRowCompression;
+    constantJacobian        = rhs.constantJacobian;
 }
 
 
@@ -253,6 +257,10 @@ ObjectiveElement& ObjectiveElement::operator=( const ObjectiveElement& rhs ){
         obj       = rhs.obj      ;
         dForward  = rhs.dForward ;
         dBackward = rhs.dBackward;
+
+        rowCompression          = rhs.rowCompression;
+        nonlinearRowCompression = rhs.nonlinearRowCompression;
+        constantJacobian        = rhs.constantJacobian;
     }
     return *this;
 }
@@ -305,7 +313,7 @@ returnValue ObjectiveElement::init( const OCPiterate &x ){
 
     t_index = fcn.index( VT_TIME, 0 );
 
-    return SUCCESSFUL_RETURN;
+    return setupJacobianCompression( );
 }
 
 
@@ -484,6 +492,122 @@ returnValue ObjectiveElement::getBackwardSensitivities( BlockMatrix *D, int orde
 
 
 
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue ObjectiveElement::setupJacobianCompression( ){
+
+    int run1, run2;
+
+    const int nh = fcn.getDim();
+
+    if( (int) rowCompression.getNumRows() == ny && (int) rowCompression.getNumCols() == nh && nh > 0 )
+        return SUCCESSFUL_RETURN;
+
+    BMatrix pattern( ny, nh );
+    pattern.setAll( true );
+
+    // C-functions are treated as dense:
+    if( fcn.isSymbolic() == BT_TRUE ){
+
+        BMatrix full;
+        ACADO_TRY( fcn.getDependencyPattern( full ) );
+
+        for( run1 = 0; run1 < ny; run1++ ){
+            for( run2 = 0; run2 < nh; run2++ ){
+                if( y_index[run1] >= 0 && y_index[run1] < (int) full.getNumCols()-1 )
+                    pattern( run1, run2 ) = full( run2, y_index[run1] );
+                else
+                    pattern( run1, run2 ) = false;
+            }
+        }
+    }
+
+    ACADO_TRY( rowCompression.init( pattern ) );
+
+    // rows of affine components are excluded from later sweeps:
+    for( run2 = 0; run2 < nh; run2++ )
+        if( fcn.isAffine( run2 ) == BT_TRUE )
+            for( run1 = 0; run1 < ny; run1++ )
+                pattern( run1, run2 ) = false;
+
+    constantJacobian.init( 0, 0 );
+
+    return nonlinearRowCompression.init( pattern );
+}
+
+
+returnValue ObjectiveElement::computeCompressedBackwardSensitivities( int number, double **J ){
+
+    int run1, run2;
+
+    const int nh      = fcn.getDim();
+    const int nVars   = fcn.getNumberOfVariables()+1;
+
+    // affine components have been differentiated before:
+    const bool isCached = ( (int) constantJacobian.getNumRows() == nh ) && ( nh > 0 );
+
+    const JacobianCompression& rows = ( isCached == true ) ? nonlinearRowCompression : rowCompression;
+    const int nColors = rows.getNumColors();
+
+    for( run1 = 0; run1 < nh; run1++ )
+        for( run2 = 0; run2 < ny; run2++ )
+            J[run1][y_index[run2]] = ( isCached == true ) ? constantJacobian( run1, run2 ) : 0.0;
+
+    if( nColors > 0 ){
+
+        // ONE VECTOR-MODE BACKWARD SWEEP, ONE DIRECTION PER COLOR:
+        // ---------------------------------------------------------
+        double *bseed = new double[nh   *nColors];
+        double *G     = new double[nVars*nColors];
+
+        for( run1 = 0; run1 < nh*nColors; run1++ )
+            bseed[run1] = 0.0;
+        for( run1 = 0; run1 < nVars*nColors; run1++ )
+            G[run1] = 0.0;
+
+        for( run1 = 0; run1 < nh; run1++ )
+            if( rows.getColor( run1 ) >= 0 )
+                bseed[run1*nColors+rows.getColor( run1 )] = 1.0;
+
+        returnValue returnvalue = fcn.AD_backward( number, nColors, bseed, G );
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            delete[] bseed;
+            delete[] G    ;
+            return ACADOERROR(returnvalue);
+        }
+
+        for( run1 = 0; run1 < nh; run1++ )
+            for( run2 = 0; run2 < ny; run2++ )
+                if( rows.isNonzero( run2, run1 ) == true )
+                    J[run1][y_index[run2]] = G[y_index[run2]*nColors+rows.getColor( run1 )];
+
+        delete[] bseed;
+        delete[] G    ;
+    }
+
+    if( isCached == true )
+        return SUCCESSFUL_RETURN;
+
+    // rows that are nonzero but not colored any more belong to affine components:
+    for( run1 = 0; run1 < nh; run1++ )
+        if( ( nonlinearRowCompression.getColor( run1 ) < 0 ) && ( rowCompression.getColor( run1 ) >= 0 ) )
+            break;
+
+    if( run1 < nh ){
+        constantJacobian.init( nh, ny );
+        for( run1 = 0; run1 < nh; run1++ )
+            for( run2 = 0; run2 < ny; run2++ )
+                constantJacobian( run1, run2 ) = J[run1][y_index[run2]];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -227,6 +227,26 @@ class ObjectiveElement{
         inline Grid getGrid() const;
 
 
+        /** Colors the rows of the Jacobian w.r.t. the stacked variables
+         *  y = (x,xa,p,u,w) based on its sparsity pattern and detects
+         *  affine components, whose Jacobian rows are constant. The
+         *  coloring is only recomputed if the dimensions have changed.    \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue setupJacobianCompression( );
+
+        /** Computes the Jacobian w.r.t. y by one vector-mode backward sweep
+         *  with one direction per row color and stores its entries
+         *  J[i][y_index[j]]. The rows of affine components are only
+         *  differentiated once and taken from constantJacobian afterwards.\n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue computeCompressedBackwardSensitivities( int      number, /**< number of the sweep */
+                                                            double **J       /**< the Jacobian        */ );
+
+
     //
     // DATA MEMBERS:
     //
@@ -241,6 +261,12 @@ class ObjectiveElement{
         int             *y_index;   /**< index lists             */
         int              t_index;   /**< time index              */
 
+        JacobianCompression rowCompression;            /**< colored rows of the Jacobian                */
+        JacobianCompression nonlinearRowCompression;   /**< colored rows of the non-affine components  */
+        DMatrix             constantJacobian;          /**< Jacobian (w.r.t. y) whose rows of affine
+                                                        *   components are constant (empty if not yet
+                                                        *   evaluated or if there are no such rows)     */
+
         int              nx     ;   /**< number of diff. states  */
         int              na     ;   /**< number of alg. states   */
         int              nu     ;   /**< number of controls      */
@@ -34,9 +34,32 @@
 #include <acado/optimization_algorithm/multi_objective_algorithm.hpp>
 #include <acado/ocp/ocp.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <thread>
+#endif
+
 BEGIN_NAMESPACE_ACADO
 
 
+/** Solution status of a single point of the Pareto front. */
+enum ParetoPointStatus
+{
+	PP_PENDING,		/**< Point has not been solved yet. */
+	PP_SOLVED,		/**< Point has been solved successfully. */
+	PP_FAILED,		/**< Solution of the point failed. */
+	PP_ADOPTED		/**< Result of a single objective optimization is adopted. */
+};
+
+
+/** Solves an already initialized subproblem, possibly within a separate thread. */
+static void solveParetoPoint(	MultiObjectiveAlgorithm* worker,
+								returnValue* returnvalue
+								)
+{
+	*returnvalue = worker->OptimizationAlgorithm::solve( );
+}
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -186,11 +209,11 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
     if( uResults  == 0 ) uResults  = new VariablesGrid[Weights.getNumCols()];
     if( wResults  == 0 ) wResults  = new VariablesGrid[Weights.getNumCols()];
 
-    getDifferentialStates( xResults[index]  );
-    getAlgebraicStates   ( xaResults[index] );
-    getParameters        ( pResults[index]  );
-    getControls          ( uResults[index]  );
-    getDisturbances      ( wResults[index]  );
+    if( getNX( )  > 0 ) getDifferentialStates( xResults[index]  );
+    if( getNXA( ) > 0 ) getAlgebraicStates   ( xaResults[index] );
+    if( getNP( )  > 0 ) getParameters        ( pResults[index]  );
+    if( getNU( )  > 0 ) getControls          ( uResults[index]  );
+    if( getNW( )  > 0 ) getDisturbances      ( wResults[index]  );
 
 
     if( returnvalue != SUCCESSFUL_RETURN )
@@ -209,11 +232,11 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
     VariablesGrid xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp;
 
     if( hotstart == BT_TRUE ){
-        getDifferentialStates( *userInit.x );
-        getAlgebraicStates   ( *userInit.xa );
-        getParameters        ( *userInit.p );
-        getControls          ( *userInit.u );
-        getDisturbances      ( *userInit.w );
+        if( getNX( )  > 0 ) getDifferentialStates( *userInit.x );
+        if( getNXA( ) > 0 ) getAlgebraicStates   ( *userInit.xa );
+        if( getNP( )  > 0 ) getParameters        ( *userInit.p );
+        if( getNU( )  > 0 ) getControls          ( *userInit.u );
+        if( getNW( )  > 0 ) getDisturbances      ( *userInit.w );
         xd_tmp = *userInit.x;
         xa_tmp = *userInit.xa;
         p_tmp  = *userInit.p;
@@ -221,11 +244,11 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
         w_tmp  = *userInit.w;
     }
     else{
-        getDifferentialStates( xd_tmp );
-        getAlgebraicStates   ( xa_tmp );
-        getParameters        ( p_tmp  );
-        getControls          ( u_tmp  );
-        getDisturbances      ( w_tmp  );
+        if( getNX( )  > 0 ) getDifferentialStates( xd_tmp );
+        if( getNXA( ) > 0 ) getAlgebraicStates   ( xa_tmp );
+        if( getNP( )  > 0 ) getParameters        ( p_tmp  );
+        if( getNU( )  > 0 ) getControls          ( u_tmp  );
+        if( getNW( )  > 0 ) getDisturbances      ( w_tmp  );
     }
 
     VariablesGrid *_xd = 0;
@@ -278,7 +301,6 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
 returnValue MultiObjectiveAlgorithm::solve( ){
 
     int           run1,run2;
-    returnValue returnvalue;
 
     ASSERT( ocp != 0 );
     ASSERT( m >= 2 );
@@ -290,6 +312,13 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     int hotstart;
     get( PARETO_FRONT_HOTSTART, hotstart );
 
+    int numThreads;
+    get( PARETO_FRONT_NUM_THREADS, numThreads );
+    if( numThreads < 1 ) numThreads = 1;
+
+    int printLevel;
+    get( PRINTLEVEL, printLevel );
+
     Expression **arg = 0;
     arg = new Expression*[m];
 
@@ -310,94 +339,213 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
     generator.getWeights( m, N, lb, ub, Weights, formers );
 
-    result.init( Weights.getNumCols(), m );
+    const int nPoints = (int) Weights.getNumCols();
+
+    result.init( nPoints, m );
     count = 0;
 
-    if( xResults  == 0 ) xResults  = new VariablesGrid[Weights.getNumCols()];
-    if( xaResults == 0 ) xaResults = new VariablesGrid[Weights.getNumCols()];
-    if( pResults  == 0 ) pResults  = new VariablesGrid[Weights.getNumCols()];
-    if( uResults  == 0 ) uResults  = new VariablesGrid[Weights.getNumCols()];
-    if( wResults  == 0 ) wResults  = new VariablesGrid[Weights.getNumCols()];
+    if( xResults  == 0 ) xResults  = new VariablesGrid[nPoints];
+    if( xaResults == 0 ) xaResults = new VariablesGrid[nPoints];
+    if( pResults  == 0 ) pResults  = new VariablesGrid[nPoints];
+    if( uResults  == 0 ) uResults  = new VariablesGrid[nPoints];
+    if( wResults  == 0 ) wResults  = new VariablesGrid[nPoints];
 
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = -acadoGetTime();
 
-    run1 = 0;
-    while( run1 < (int) Weights.getNumCols() ){
 
+    // CLASSIFY THE PARETO POINTS:
+    // ---------------------------
 
-        // PRINT THE ITERATION NUMBER:
-        // ---------------------------
-    	printf("\n\n Multi-objective point: %d out of %d \n\n",run1+1, (int) Weights.getNumCols() );
-
-
-        ocp->getConstraint( tmp_con );
-
-        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
-            idx[run2] = Weights( run2, run1 );
+    std::vector<int> pointStatus( nPoints, PP_PENDING );
+    std::vector<int> vertexOf   ( nPoints, -1         );
 
+    for( run1 = 0; run1 < nPoints; run1++ ){
 
         // THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS
-
-        int vertex = -1;
         for( run2 = 0; run2 < m; run2++ ){
-            if( fabs( idx[run2]-1.0 ) < 100.0*EPS )
-                vertex = run2;
+            if( fabs( Weights( run2, run1 )-1.0 ) < 100.0*EPS )
+                vertexOf[run1] = run2;
         }
         // ----------------------------------------------------------
 
+        if( vertexOf[run1] != -1 && paretoGeneration != PFG_WEIGHTED_SUM ){
 
-        if( vertex == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
+            printf("\n\n Multi-objective point: %d out of %d \n\n",run1+1, nPoints );
+            printf(" Result from single objective optimization is adopted. \n\n" );
 
-            formulateOCP( idx, ocp, arg );
-            setStatus( BS_NOT_INITIALIZED );
-            returnvalue = OptimizationAlgorithm::solve();
+            // single objective solutions serve as warm start for their neighbours:
+            if( xResults[run1].isEmpty() == BT_FALSE )
+                pointStatus[run1] = PP_SOLVED;
+            else
+                pointStatus[run1] = PP_ADOPTED;
+        }
+    }
 
-            if( nlpSolver != 0 )
-                totalNumberOfSQPiterations += nlpSolver->getNumberOfSteps();
 
-            ocp->setConstraint( tmp_con );
-            set( PRINT_COPYRIGHT, BT_FALSE );
+    // SOLVE THE REMAINING POINTS IN WAVES OF AT MOST numThreads POINTS:
+    // -----------------------------------------------------------------
 
-            if( returnvalue != SUCCESSFUL_RETURN ){
-                ACADOERROR(returnvalue);
-            }
-            else{
-
-               getDifferentialStates( xResults[run1]  );
-               getAlgebraicStates   ( xaResults[run1] );
-               getParameters        ( pResults[run1]  );
-               getControls          ( uResults[run1]  );
-               getDisturbances      ( wResults[run1]  );
-
-               if( hotstart == BT_TRUE ){
-                    getDifferentialStates( *userInit.x );
-                    getAlgebraicStates   ( *userInit.xa );
-                    getParameters        ( *userInit.p  );
-                    getControls          ( *userInit.u );
-                    getDisturbances      ( *userInit.w  );
-                    evaluateObjectives( *userInit.x, *userInit.xa, *userInit.p, *userInit.u, *userInit.w, arg );
+    MultiObjectiveAlgorithm *lastWorker = 0;
+    int                      lastPoint  = -1;
+
+    std::vector<int> wave;
+    selectParetoPoints( Weights, pointStatus, hotstart, numThreads, wave );
+
+    while( wave.empty() == false ){
+
+        int nWave = (int) wave.size();
+
+        std::vector<MultiObjectiveAlgorithm*> workers( nWave, (MultiObjectiveAlgorithm*) 0 );
+        std::vector<returnValue>              returnvalues( nWave, SUCCESSFUL_RETURN );
+
+        // The symbolic set-up of the subproblems is not thread-safe
+        // and is therefore done sequentially:
+        for( run1 = 0; run1 < nWave; run1++ ){
+
+            int point = wave[run1];
+
+            // points solved concurrently are reported after their solution
+            // and their solvers print errors only, so that the output of
+            // different threads does not interleave
+            if( nWave == 1 )
+                printf("\n\n Multi-objective point: %d out of %d \n\n",point+1, nPoints );
+
+            for( run2 = 0; run2 < m; run2++ )
+                idx[run2] = Weights( run2, point );
+
+            // each worker sets up its own NLP solver, so only the problem
+            // formulation, the options and the initialization are copied:
+            MultiObjectiveAlgorithm *worker = new MultiObjectiveAlgorithm( *ocp );
+            worker->setOptions( *this );
+            if( nWave > 1 && printLevel > LOW )
+                worker->set( PRINTLEVEL, LOW );
+            worker->m        = m;
+            worker->N        = N;
+            worker->vertices = vertices;
+            worker->userInit = userInit;
+            workers[run1]    = worker;
+
+            // copies of an OCP share their constraint, which is extended below:
+            ocp->getConstraint( tmp_con );
+            worker->ocp->setConstraint( tmp_con );
+
+            worker->formulateOCP( idx, worker->ocp, arg );
+
+            if( hotstart == BT_TRUE ){
+
+                int neighbour = getNearestSolvedPoint( Weights, pointStatus, point );
+
+                if( neighbour >= 0 ){
+                    if( xResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeDifferentialStates( xResults [neighbour] );
+                    if( xaResults[neighbour].isEmpty() == BT_FALSE ) worker->initializeAlgebraicStates   ( xaResults[neighbour] );
+                    if( pResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeParameters        ( pResults [neighbour] );
+                    if( uResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeControls          ( uResults [neighbour] );
+                    if( wResults [neighbour].isEmpty() == BT_FALSE ) worker->initializeDisturbances      ( wResults [neighbour] );
                 }
-                else{
-                   VariablesGrid xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp;
-                   getDifferentialStates( xd_tmp );
-                   getAlgebraicStates   ( xa_tmp );
-                   getParameters        ( p_tmp  );
-                   getControls          ( u_tmp  );
-                   getDisturbances      ( w_tmp  );
-                   evaluateObjectives( xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp, arg );
-               }
             }
+
+            worker->setStatus( BS_NOT_INITIALIZED );
+            returnvalues[run1] = worker->init( );
         }
-        else{
-        	printf(" Result from single objective optimization is adopted. \n\n" );
-            for( run2 = 0; run2 < m; run2++ ){
-                result(count,run2) = vertices(vertex,run2);
+
+        // The numerical solution of the subproblems is independent:
+#ifdef ACADO_HAS_CXX11
+        if( nWave > 1 ){
+
+            std::vector<std::thread> threads;
+            for( run1 = 0; run1 < nWave; run1++ )
+                if( returnvalues[run1] == SUCCESSFUL_RETURN )
+                    threads.push_back( std::thread( solveParetoPoint, workers[run1], &returnvalues[run1] ) );
+
+            for( run1 = 0; run1 < (int) threads.size(); run1++ )
+                threads[run1].join();
+        }
+        else
+#endif
+        {
+            for( run1 = 0; run1 < nWave; run1++ )
+                if( returnvalues[run1] == SUCCESSFUL_RETURN )
+                    solveParetoPoint( workers[run1], &returnvalues[run1] );
+        }
+
+        // Collect the results:
+        for( run1 = 0; run1 < nWave; run1++ ){
+
+            int                      point  = wave[run1];
+            MultiObjectiveAlgorithm *worker = workers[run1];
+
+            if( nWave > 1 )
+                printf("\n\n Multi-objective point: %d out of %d \n\n",point+1, nPoints );
+
+            if( worker->nlpSolver != 0 )
+                totalNumberOfSQPiterations += worker->nlpSolver->getNumberOfSteps();
+
+            if( returnvalues[run1] != SUCCESSFUL_RETURN ){
+                ACADOERROR(returnvalues[run1]);
+                pointStatus[point] = PP_FAILED;
+                delete worker;
+                continue;
             }
+
+            if( worker->getNX( )  > 0 ) worker->getDifferentialStates( xResults[point]  );
+            if( worker->getNXA( ) > 0 ) worker->getAlgebraicStates   ( xaResults[point] );
+            if( worker->getNP( )  > 0 ) worker->getParameters        ( pResults[point]  );
+            if( worker->getNU( )  > 0 ) worker->getControls          ( uResults[point]  );
+            if( worker->getNW( )  > 0 ) worker->getDisturbances      ( wResults[point]  );
+
+            pointStatus[point] = PP_SOLVED;
+
+            if( point > lastPoint ){
+                if( lastWorker != 0 ) delete lastWorker;
+                lastWorker = worker;
+                lastPoint  = point;
+            }
+            else
+                delete worker;
+        }
+
+        set( PRINT_COPYRIGHT, BT_FALSE );
+        selectParetoPoints( Weights, pointStatus, hotstart, numThreads, wave );
+    }
+
+
+    // STORE THE OBJECTIVE VALUES IN THE ORDER OF THE WEIGHTS:
+    // -------------------------------------------------------
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        if( vertexOf[run1] != -1 && paretoGeneration != PFG_WEIGHTED_SUM ){
+            for( run2 = 0; run2 < m; run2++ )
+                result(count,run2) = vertices(vertexOf[run1],run2);
             count++;
         }
-        run1++;
+        else{
+            if( pointStatus[run1] == PP_SOLVED )
+                evaluateObjectives( xResults[run1], xaResults[run1], pResults[run1], uResults[run1], wResults[run1], arg );
+        }
+    }
+
+    // The solution of the last Pareto point remains accessible via the
+    // usual getters and serves as initialization for subsequent calls:
+    if( lastWorker != 0 ){
+
+        NLPsolver *tmp         = nlpSolver;
+        nlpSolver              = lastWorker->nlpSolver;
+        lastWorker->nlpSolver  = tmp;
+
+        if( hotstart == BT_TRUE ){
+            if( xResults [lastPoint].isEmpty() == BT_FALSE ) initializeDifferentialStates( xResults [lastPoint] );
+            if( xaResults[lastPoint].isEmpty() == BT_FALSE ) initializeAlgebraicStates   ( xaResults[lastPoint] );
+            if( pResults [lastPoint].isEmpty() == BT_FALSE ) initializeParameters        ( pResults [lastPoint] );
+            if( uResults [lastPoint].isEmpty() == BT_FALSE ) initializeControls          ( uResults [lastPoint] );
+            if( wResults [lastPoint].isEmpty() == BT_FALSE ) initializeDisturbances      ( wResults [lastPoint] );
+        }
+
+        setStatus( BS_NOT_INITIALIZED );
+        delete lastWorker;
     }
+
     totalCPUtime += acadoGetTime();
 
     for( run1 = 0; run1 < m; run1++ )
@@ -411,6 +559,7 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
 
 
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -420,6 +569,7 @@ returnValue MultiObjectiveAlgorithm::setupOptions( )
     addOption( PARETO_FRONT_DISCRETIZATION  , defaultParetoFrontDiscretization );
     addOption( PARETO_FRONT_GENERATION      , defaultParetoFrontGeneration     );
     addOption( PARETO_FRONT_HOTSTART        , defaultParetoFrontHotstart       );
+    addOption( PARETO_FRONT_NUM_THREADS     , defaultParetoFrontNumThreads     );
 
 	// add optimization algorithm options
 	//OptimizationAlgorithm::setupOptions( );
@@ -620,6 +770,98 @@ returnValue MultiObjectiveAlgorithm::formulateOCP( double *idx, OCP *ocp_, Expre
 }
 
 
+int MultiObjectiveAlgorithm::getNearestSolvedPoint(	const DMatrix& Weights,
+														const std::vector<int>& pointStatus,
+														int point
+														) const
+{
+    int    run1, run2;
+    int    nearest     = -1;
+    double minDistance = INFTY;
+
+    for( run1 = 0; run1 < (int) Weights.getNumCols(); run1++ ){
+
+        if( pointStatus[run1] != PP_SOLVED )
+            continue;
+
+        double distance = 0.0;
+        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
+            distance += ( Weights(run2,run1) - Weights(run2,point) )*( Weights(run2,run1) - Weights(run2,point) );
+
+        if( distance < minDistance ){
+            minDistance = distance;
+            nearest     = run1;
+        }
+    }
+    return nearest;
+}
+
+
+returnValue MultiObjectiveAlgorithm::selectParetoPoints(	const DMatrix& Weights,
+															const std::vector<int>& pointStatus,
+															int hotstart,
+															int numThreads,
+															std::vector<int>& wave
+															) const
+{
+    int run1, run2;
+
+    wave.clear();
+
+    std::vector<int> pending;
+    for( run1 = 0; run1 < (int) pointStatus.size(); run1++ )
+        if( pointStatus[run1] == PP_PENDING )
+            pending.push_back( run1 );
+
+    if( pending.empty() == true )
+        return SUCCESSFUL_RETURN;
+
+    if( hotstart != BT_TRUE ){
+        for( run1 = 0; run1 < (int) pending.size() && run1 < numThreads; run1++ )
+            wave.push_back( pending[run1] );
+        return SUCCESSFUL_RETURN;
+    }
+
+    // Without any solved point, the first point is solved on its own such
+    // that all subsequent points can be warm started:
+    std::vector<double> distance( pending.size(), INFTY );
+    BooleanType anySolved = BT_FALSE;
+
+    for( run1 = 0; run1 < (int) pending.size(); run1++ ){
+
+        int neighbour = getNearestSolvedPoint( Weights, pointStatus, pending[run1] );
+        if( neighbour < 0 )
+            continue;
+
+        anySolved      = BT_TRUE;
+        distance[run1] = 0.0;
+        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
+            distance[run1] += ( Weights(run2,neighbour) - Weights(run2,pending[run1]) )*( Weights(run2,neighbour) - Weights(run2,pending[run1]) );
+    }
+
+    if( anySolved == BT_FALSE ){
+        wave.push_back( pending[0] );
+        return SUCCESSFUL_RETURN;
+    }
+
+    // Pick the pending points that are closest to the already solved ones:
+    std::vector<bool> taken( pending.size(), false );
+
+    while( (int) wave.size() < numThreads && wave.size() < pending.size() ){
+
+        int best = -1;
+        for( run1 = 0; run1 < (int) pending.size(); run1++ )
+            if( taken[run1] == false && ( best < 0 || distance[run1] < distance[best] ) )
+                best = run1;
+
+        taken[best] = true;
+        wave.push_back( pending[best] );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
                                                          VariablesGrid    &xa_ ,
                                                          VariablesGrid    &p_  ,
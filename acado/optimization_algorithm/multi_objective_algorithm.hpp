@@ -37,6 +37,8 @@
 #include <acado/optimization_algorithm/optimization_algorithm.hpp>
 #include <acado/optimization_algorithm/weight_generation.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -49,6 +51,12 @@ BEGIN_NAMESPACE_ACADO
  *	The class MultiObjectiveAlgorithm serves as a user-interface to formulate and
  *  solve optimal control problems with multiple objectives.
  *
+ *  Each point of the Pareto front is solved by a copy of this algorithm.
+ *  The option PARETO_FRONT_NUM_THREADS allows to solve several points
+ *  concurrently (requires C++11 support). If PARETO_FRONT_HOTSTART is
+ *  enabled, each point is initialized with the solution of its nearest
+ *  already solved neighbour in weight space.
+ *
  *  \author Boris Houska, Hans Joachim Ferreau
  */
 class MultiObjectiveAlgorithm : public OptimizationAlgorithm
@@ -245,6 +253,31 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
                                         Expression      **arg1  );
 
 
+        /** Returns the index of the solved Pareto point whose weights are \n
+         *  closest (in the Euclidean norm) to those of the given point.   \n
+         *                                                                 \n
+         *  \return index of the nearest solved point, or -1 if no point   \n
+         *          has been solved yet.                                   \n
+         */
+        int getNearestSolvedPoint( const DMatrix&          Weights    ,
+                                   const std::vector<int>& pointStatus,
+                                   int                     point        ) const;
+
+
+        /** Selects the next Pareto points to be solved concurrently.      \n
+         *  If hotstarts are enabled, the pending points nearest to the    \n
+         *  already solved points are preferred such that each point can   \n
+         *  be warm started from its nearest solved neighbour.             \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue selectParetoPoints( const DMatrix&          Weights    ,
+                                        const std::vector<int>& pointStatus,
+                                        int                     hotstart   ,
+                                        int                     numThreads ,
+                                        std::vector<int>&       wave         ) const;
+
+
 
 
         inline returnValue printAuxiliaryRoutine( const char*fileName, VariablesGrid *x_ ) const;
@@ -45,6 +45,8 @@ BEGIN_NAMESPACE_ACADO
 
 OptimizationAlgorithm::OptimizationAlgorithm( ) : OptimizationAlgorithmBase( ), UserInteraction( )
 {
+	warmStartDatabase = 0;
+
 	setupOptions( );
 	setupLogging( );
 	
@@ -54,6 +56,8 @@ OptimizationAlgorithm::OptimizationAlgorithm( ) : OptimizationAlgorithmBase( ),
 
 OptimizationAlgorithm::OptimizationAlgorithm( const OCP& ocp_ ) : OptimizationAlgorithmBase( ocp_ ), UserInteraction( )
 {
+	warmStartDatabase = 0;
+
 	setupOptions( );
 	setupLogging( );
 }
@@ -62,6 +66,8 @@ OptimizationAlgorithm::OptimizationAlgorithm( const OCP& ocp_ ) : OptimizationAl
 OptimizationAlgorithm::OptimizationAlgorithm( const OptimizationAlgorithm& arg )
                       : OptimizationAlgorithmBase( arg ), UserInteraction( arg )
 {
+	warmStartDatabase = arg.warmStartDatabase;
+	warmStartKey      = arg.warmStartKey;
 }
 
 
@@ -77,6 +83,9 @@ OptimizationAlgorithm& OptimizationAlgorithm::operator=( const OptimizationAlgor
 	{
 		OptimizationAlgorithmBase::operator=( arg );
 		UserInteraction::operator=( arg );
+
+		warmStartDatabase = arg.warmStartDatabase;
+		warmStartKey      = arg.warmStartKey;
 	}
 
 	return *this;
@@ -102,7 +111,13 @@ returnValue OptimizationAlgorithm::solve( ){
     returnValue returnvalue = SUCCESSFUL_RETURN;
 
 	if ( ( getStatus( ) != BS_READY ) || ( haveOptionsChanged( ) == BT_TRUE ) )
-    	returnvalue = init( );
+	{
+		if ( getStatus( ) != BS_READY )
+			returnvalue = initializeFromWarmStartDatabase( );
+
+		if ( returnvalue == SUCCESSFUL_RETURN )
+			returnvalue = init( );
+	}
 
     if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
     
@@ -116,7 +131,19 @@ returnValue OptimizationAlgorithm::solve( ){
 		else
 			return ACADOERROR( RET_OPTALG_SOLVE_FAILED );
 	}
-    return SUCCESSFUL_RETURN;
+
+	return storeInWarmStartDatabase( );
+}
+
+
+returnValue OptimizationAlgorithm::setWarmStartDatabase(	WarmStartDatabase* database,
+															const DVector& key
+															)
+{
+	warmStartDatabase = database;
+	warmStartKey      = key;
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -138,6 +165,7 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( PRINT_COPYRIGHT             , defaultPrintCopyright          );
 	addOption( HESSIAN_APPROXIMATION       , defaultHessianApproximation    );
 	addOption( DYNAMIC_HESSIAN_APPROXIMATION, defaultDynamicHessianApproximation );
+	addOption( LBFGS_MEMORY_SIZE           , defaultLBFGSmemorySize         );
 	addOption( DYNAMIC_SENSITIVITY         , defaultDynamicSensitivity      );
 	addOption( OBJECTIVE_SENSITIVITY       , defaultObjectiveSensitivity    );
 	addOption( CONSTRAINT_SENSITIVITY      , defaultConstraintSensitivity   );
@@ -216,6 +244,50 @@ returnValue OptimizationAlgorithm::initializeObjective(	Objective* F
 }
 
 
+returnValue OptimizationAlgorithm::initializeFromWarmStartDatabase( )
+{
+	if ( ( warmStartDatabase == 0 ) || ( warmStartDatabase->isEmpty( ) == BT_TRUE ) )
+		return SUCCESSFUL_RETURN;
+
+	OCPiterate nearest;
+	ACADO_TRY( warmStartDatabase->getNearest( warmStartKey,nearest ) );
+
+	if ( ( nearest.x != 0 ) && ( nearest.x->isEmpty( ) == BT_FALSE ) )
+		initializeDifferentialStates( *nearest.x );
+
+	if ( ( nearest.xa != 0 ) && ( nearest.xa->isEmpty( ) == BT_FALSE ) )
+		initializeAlgebraicStates( *nearest.xa );
+
+	if ( ( nearest.p != 0 ) && ( nearest.p->isEmpty( ) == BT_FALSE ) )
+		initializeParameters( *nearest.p );
+
+	if ( ( nearest.u != 0 ) && ( nearest.u->isEmpty( ) == BT_FALSE ) )
+		initializeControls( *nearest.u );
+
+	if ( ( nearest.w != 0 ) && ( nearest.w->isEmpty( ) == BT_FALSE ) )
+		initializeDisturbances( *nearest.w );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OptimizationAlgorithm::storeInWarmStartDatabase( ) const
+{
+	if ( warmStartDatabase == 0 )
+		return SUCCESSFUL_RETURN;
+
+	VariablesGrid xd, xa, p, u, w;
+
+	if ( getNX( )  > 0 ) getDifferentialStates( xd );
+	if ( getNXA( ) > 0 ) getAlgebraicStates( xa );
+	if ( getNP( )  > 0 ) getParameters( p );
+	if ( getNU( )  > 0 ) getControls( u );
+	if ( getNW( )  > 0 ) getDisturbances( w );
+
+	return warmStartDatabase->add( warmStartKey,OCPiterate( &xd,&xa,&p,&u,&w ) );
+}
+
+
 
 
 CLOSE_NAMESPACE_ACADO
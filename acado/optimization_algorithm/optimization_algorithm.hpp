@@ -35,6 +35,7 @@
 
 #include <acado/user_interaction/user_interaction.hpp>
 #include <acado/optimization_algorithm/optimization_algorithm_base.hpp>
+#include <acado/optimization_algorithm/warm_start_database.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -85,6 +86,24 @@ class OptimizationAlgorithm : public OptimizationAlgorithmBase, public UserInter
         virtual returnValue solve( );
 
 
+		/** Attaches a database of previously converged iterates (it is not
+		 *	copied, thus it has to stay alive while the algorithm is used).
+		 *	Before the first solve, the algorithm is initialized with the
+		 *	stored iterate whose key is nearest to the given one, overriding
+		 *	any user-supplied initialization. After successful convergence,
+		 *	the solution is added to the database under the given key.
+		 *
+		 *	\param database  warm-start database, 0 to detach
+		 *	\param key       key of the problem instance, e.g. its initial
+		 *	                 state and parameter values
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setWarmStartDatabase(	WarmStartDatabase* database,
+											const DVector& key
+											);
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
@@ -114,11 +133,21 @@ class OptimizationAlgorithm : public OptimizationAlgorithmBase, public UserInter
         virtual returnValue initializeObjective(	Objective* F
 													);
 
+		/** Initializes the algorithm with the iterate of the attached
+		 *	warm-start database that is nearest to the current key. */
+		returnValue initializeFromWarmStartDatabase( );
+
+		/** Adds the current solution to the attached warm-start database. */
+		returnValue storeInWarmStartDatabase( ) const;
+
 
     //
     // DATA MEMBERS:
     //
     protected:
+
+		WarmStartDatabase* warmStartDatabase;	/**< Attached warm-start database (not owned). */
+		DVector warmStartKey;					/**< Key of the current problem instance. */
 };
 
 
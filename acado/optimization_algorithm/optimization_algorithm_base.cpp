@@ -879,8 +879,9 @@ returnValue OptimizationAlgorithmBase::initializeOCPiterate(	Constraint* const _
     BooleanType ai;
     if( nx > 0 && userInit.x->getNumPoints() > 0 ){
         ai=userInit.x->getAutoInit(0);
+        uint hint = 0;
         for( run1 = 0; run1 < _unionGrid.getNumPoints(); run1++ ){
-            DVector tmp = userInit.x->linearInterpolation( _unionGrid.getTime(run1) );
+            DVector tmp = userInit.x->linearInterpolation( _unionGrid.getTime(run1),hint );
             uint nxx = tmp.getDim();
             if( nxx > nx ) nxx = nx;
             for( run2 = 0; run2 < nxx; run2++ )
@@ -891,8 +892,9 @@ returnValue OptimizationAlgorithmBase::initializeOCPiterate(	Constraint* const _
     
     if( nxa > 0 && userInit.xa->getNumPoints() > 0 ){
         ai=userInit.xa->getAutoInit(0);
+        uint hint = 0;
         for( run1 = 0; run1 < _unionGrid.getNumPoints(); run1++ ){
-            DVector tmp = userInit.xa->linearInterpolation( _unionGrid.getTime(run1) );
+            DVector tmp = userInit.xa->linearInterpolation( _unionGrid.getTime(run1),hint );
 			uint nxx = tmp.getDim();
             if( nxx > nxa ) nxx = nxa;
             for( run2 = 0; run2 < nxx; run2++ )
@@ -902,8 +904,9 @@ returnValue OptimizationAlgorithmBase::initializeOCPiterate(	Constraint* const _
     }	
 	
     if( nu > 0 && userInit.u->getNumPoints() > 0 ){
+        uint hint = 0;
         for( run1 = 0; run1 < _unionGrid.getNumPoints(); run1++ ){
-            DVector tmp = userInit.u->linearInterpolation( _unionGrid.getTime(run1) );
+            DVector tmp = userInit.u->linearInterpolation( _unionGrid.getTime(run1),hint );
             uint nxx = tmp.getDim();
             if( nxx > nu ) nxx = nu;
             for( run2 = 0; run2 < nxx; run2++ )
@@ -930,8 +933,9 @@ returnValue OptimizationAlgorithmBase::initializeOCPiterate(	Constraint* const _
 //     }
 
     if( nw > 0 && userInit.w->getNumPoints() > 0 ){
+        uint hint = 0;
         for( run1 = 0; run1 < _unionGrid.getNumPoints(); run1++ ){
-            DVector tmp = userInit.w->linearInterpolation( _unionGrid.getTime(run1) );
+            DVector tmp = userInit.w->linearInterpolation( _unionGrid.getTime(run1),hint );
             uint nxx = tmp.getDim();
             if( nxx > nw ) nxx = nw;
             for( run2 = 0; run2 < nxx; run2++ )
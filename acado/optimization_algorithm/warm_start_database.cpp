@@ -0,0 +1,343 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/optimization_algorithm/warm_start_database.cpp
+ */
+
+
+#include <acado/optimization_algorithm/warm_start_database.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+static const char* const warmStartDatabaseHeader = "ACADO_WARM_START_DATABASE";
+static const int warmStartDatabaseVersion = 1;
+
+
+static void writeGrid(	std::ostream& stream,
+						const VariablesGrid* const grid
+						)
+{
+	// grids without values are written as empty ones, readGrid( ) does
+	// not expect any time lines for them
+	if ( ( grid == 0 ) || ( grid->isEmpty( ) == BT_TRUE ) || ( grid->getNumValues( ) == 0 ) )
+	{
+		stream << "0 0" << std::endl;
+		return;
+	}
+
+	stream << grid->getNumPoints( ) << " " << grid->getNumValues( ) << std::endl;
+
+	for( uint i = 0; i < grid->getNumPoints( ); ++i )
+	{
+		stream << grid->getTime( i );
+		for( uint j = 0; j < grid->getNumValues( ); ++j )
+			stream << " " << (*grid)( i,j );
+		stream << std::endl;
+	}
+}
+
+
+static VariablesGrid* readGrid(	std::istream& stream,
+								bool& isValid
+								)
+{
+	uint nPoints = 0, nValues = 0;
+
+	if ( !( stream >> nPoints >> nValues ) )
+	{
+		isValid = false;
+		return 0;
+	}
+
+	if ( ( nPoints == 0 ) || ( nValues == 0 ) )
+		return 0;
+
+	VariablesGrid* grid = new VariablesGrid( );
+	DVector v( nValues );
+	double t;
+
+	for( uint i = 0; i < nPoints; ++i )
+	{
+		stream >> t;
+		for( uint j = 0; j < nValues; ++j )
+			stream >> v( j );
+
+		if ( !stream )
+		{
+			isValid = false;
+			delete grid;
+			return 0;
+		}
+
+		grid->addVector( v,t );
+	}
+
+	return grid;
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+WarmStartDatabase::WarmStartDatabase( )
+{
+}
+
+
+WarmStartDatabase::WarmStartDatabase( const WarmStartDatabase& arg )
+{
+	keys     = arg.keys;
+	iterates = arg.iterates;
+	scaling  = arg.scaling;
+}
+
+
+WarmStartDatabase::~WarmStartDatabase( )
+{
+}
+
+
+WarmStartDatabase& WarmStartDatabase::operator=( const WarmStartDatabase& arg )
+{
+	if ( this != &arg )
+	{
+		keys     = arg.keys;
+		iterates = arg.iterates;
+		scaling  = arg.scaling;
+	}
+
+	return *this;
+}
+
+
+returnValue WarmStartDatabase::add(	const DVector& key,
+									const OCPiterate& iterate
+									)
+{
+	if ( ( isEmpty( ) == BT_FALSE ) && ( key.getDim( ) != getKeyDim( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( scaling.isEmpty( ) == false ) && ( key.getDim( ) != scaling.getDim( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	for( uint i = 0; i < keys.size( ); ++i )
+	{
+		if ( keys[ i ] == key )
+		{
+			iterates[ i ] = iterate;
+			return SUCCESSFUL_RETURN;
+		}
+	}
+
+	keys.push_back( key );
+	iterates.push_back( iterate );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue WarmStartDatabase::getNearest(	const DVector& key,
+											OCPiterate& iterate,
+											double* distance
+											) const
+{
+	if ( isEmpty( ) == BT_TRUE )
+		return RET_INVALID_ARGUMENTS;
+
+	if ( key.getDim( ) != getKeyDim( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	// linear scan; the number of entries is expected to be moderate compared
+	// to the cost of a single OCP solve
+	uint nearest = 0;
+	double minDistance = getSquaredDistance( key,keys[ 0 ] );
+
+	for( uint i = 1; i < keys.size( ); ++i )
+	{
+		double tmp = getSquaredDistance( key,keys[ i ] );
+		if ( tmp < minDistance )
+		{
+			minDistance = tmp;
+			nearest = i;
+		}
+	}
+
+	iterate = iterates[ nearest ];
+
+	if ( distance != 0 )
+		*distance = sqrt( minDistance );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue WarmStartDatabase::setKeyScaling( const DVector& _scaling )
+{
+	if ( ( _scaling.isEmpty( ) == false ) && ( isEmpty( ) == BT_FALSE ) && ( _scaling.getDim( ) != getKeyDim( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	scaling = _scaling;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue WarmStartDatabase::clear( )
+{
+	keys.clear( );
+	iterates.clear( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue WarmStartDatabase::write( const char* fileName ) const
+{
+	std::ofstream stream( fileName );
+
+	if ( !stream )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	stream << std::scientific << std::setprecision( 16 );
+
+	stream << warmStartDatabaseHeader << " " << warmStartDatabaseVersion << std::endl;
+	stream << getNumEntries( ) << " " << getKeyDim( ) << std::endl;
+
+	for( uint i = 0; i < keys.size( ); ++i )
+	{
+		for( uint j = 0; j < keys[ i ].getDim( ); ++j )
+			stream << ( j > 0 ? " " : "" ) << keys[ i ]( j );
+		stream << std::endl;
+
+		writeGrid( stream,iterates[ i ].x  );
+		writeGrid( stream,iterates[ i ].xa );
+		writeGrid( stream,iterates[ i ].p  );
+		writeGrid( stream,iterates[ i ].u  );
+		writeGrid( stream,iterates[ i ].w  );
+	}
+
+	if ( !stream )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue WarmStartDatabase::read( const char* fileName )
+{
+	std::ifstream stream( fileName );
+
+	if ( !stream )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	std::string header;
+	int version = 0;
+	uint nEntries = 0, keyDim = 0;
+
+	stream >> header >> version >> nEntries >> keyDim;
+
+	if ( ( !stream ) || ( header != warmStartDatabaseHeader ) || ( version != warmStartDatabaseVersion ) )
+		return ACADOERROR( RET_FILE_HAS_NO_VALID_ENTRIES );
+
+	std::vector< DVector > newKeys;
+	std::vector< OCPiterate > newIterates;
+
+	for( uint i = 0; i < nEntries; ++i )
+	{
+		DVector key( keyDim );
+		for( uint j = 0; j < keyDim; ++j )
+			stream >> key( j );
+
+		bool isValid = stream ? true : false;
+		VariablesGrid* x  = readGrid( stream,isValid );
+		VariablesGrid* xa = readGrid( stream,isValid );
+		VariablesGrid* p  = readGrid( stream,isValid );
+		VariablesGrid* u  = readGrid( stream,isValid );
+		VariablesGrid* w  = readGrid( stream,isValid );
+
+		if ( isValid == true )
+		{
+			newKeys.push_back( key );
+			newIterates.push_back( OCPiterate( x,xa,p,u,w ) );
+		}
+
+		if ( x  != 0 ) delete x;
+		if ( xa != 0 ) delete xa;
+		if ( p  != 0 ) delete p;
+		if ( u  != 0 ) delete u;
+		if ( w  != 0 ) delete w;
+
+		if ( isValid == false )
+			return ACADOERROR( RET_FILE_HAS_NO_VALID_ENTRIES );
+	}
+
+	keys     = newKeys;
+	iterates = newIterates;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+double WarmStartDatabase::getSquaredDistance(	const DVector& a,
+												const DVector& b
+												) const
+{
+	double result = 0.0;
+
+	for( uint i = 0; i < a.getDim( ); ++i )
+	{
+		double tmp = a( i ) - b( i );
+		if ( scaling.isEmpty( ) == false )
+			tmp *= scaling( i );
+		result += tmp * tmp;
+	}
+
+	return result;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+// end of file.
@@ -0,0 +1,167 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/optimization_algorithm/warm_start_database.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_WARM_START_DATABASE_HPP
+#define ACADO_TOOLKIT_WARM_START_DATABASE_HPP
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/function/ocp_iterate.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Stores converged OCP iterates for warm-starting repeated solves.
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	The class WarmStartDatabase stores converged iterates of an optimal control
+ *	problem, each indexed by a key vector (e.g. the initial state and the
+ *	parameters the problem has been solved for). When the same problem is
+ *	solved again for a different key, the iterate belonging to the nearest
+ *	stored key (in the possibly scaled Euclidean norm) can be used as
+ *	initialization. The database can be written to and read from a text file
+ *	in order to be reused between runs.
+ */
+class WarmStartDatabase{
+
+
+    public:
+
+        /** Default constructor. */
+        WarmStartDatabase( );
+
+        /** Copy constructor (deep copy). */
+        WarmStartDatabase( const WarmStartDatabase& arg );
+
+        /** Destructor. */
+        virtual ~WarmStartDatabase( );
+
+        /** Assignment operator (deep copy). */
+        WarmStartDatabase& operator=( const WarmStartDatabase& arg );
+
+
+        /** Adds an iterate for the given key. An entry having the
+         *  same key is replaced.
+         *
+         *  \param key      key vector of the iterate
+         *  \param iterate  iterate to be stored
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_VECTOR_DIMENSION_MISMATCH
+         */
+        returnValue add(    const DVector& key,
+                            const OCPiterate& iterate
+                            );
+
+        /** Looks up the iterate whose key is nearest to the given one.
+         *
+         *  \param key       key vector to search for
+         *  \param iterate   output: iterate of the nearest entry
+         *  \param distance  output (optional): distance to the nearest key
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_INVALID_ARGUMENTS (database is empty), \n
+         *          RET_VECTOR_DIMENSION_MISMATCH
+         */
+        returnValue getNearest( const DVector& key,
+                                OCPiterate& iterate,
+                                double* distance = 0
+                                ) const;
+
+        /** Sets the weights by which each key component is scaled before
+         *  computing distances; an empty vector disables scaling.
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_VECTOR_DIMENSION_MISMATCH
+         */
+        returnValue setKeyScaling( const DVector& _scaling );
+
+        /** Removes all entries. */
+        returnValue clear( );
+
+
+        /** Returns the number of stored entries. */
+        inline uint getNumEntries( ) const;
+
+        /** Returns whether the database is empty. */
+        inline BooleanType isEmpty( ) const;
+
+        /** Returns the dimension of the keys (0 if empty). */
+        inline uint getKeyDim( ) const;
+
+
+        /** Writes all entries to a text file.
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_FILE_CAN_NOT_BE_OPENED
+         */
+        returnValue write( const char* fileName ) const;
+
+        /** Reads entries from a text file written by write(), replacing all
+         *  current entries.
+         *
+         *  \return SUCCESSFUL_RETURN, \n
+         *          RET_FILE_CAN_NOT_BE_OPENED, \n
+         *          RET_FILE_HAS_NO_VALID_ENTRIES
+         */
+        returnValue read( const char* fileName );
+
+
+
+    protected:
+
+        /** Returns the (scaled) squared distance between two keys. */
+        double getSquaredDistance(  const DVector& a,
+                                    const DVector& b
+                                    ) const;
+
+
+    protected:
+
+        std::vector< DVector > keys;            /**< Keys of all entries. */
+        std::vector< OCPiterate > iterates;     /**< Iterates of all entries. */
+        DVector scaling;                        /**< Scaling of the key components. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/optimization_algorithm/warm_start_database.ipp>
+
+
+#endif  // ACADO_TOOLKIT_WARM_START_DATABASE_HPP
+
+/*
+ *   end of file
+ */
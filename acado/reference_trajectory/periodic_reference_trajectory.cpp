@@ -110,7 +110,9 @@ returnValue PeriodicReferenceTrajectory::getReference(	double tStart,
 
 	if ( nStart == nEnd )
 	{
-		_yRef = (yRef.getTimeSubGrid( tStart-T*(double)nStart,tEnd-T*(double)nStart )).shiftTimes( T*(double)nStart );
+		yRefWindow.init( yRef,tStart-T*(double)nStart,tEnd-T*(double)nStart );
+		_yRef = yRefWindow;
+		_yRef.shiftTimes( T*(double)nStart );
 	}
 	else
 	{
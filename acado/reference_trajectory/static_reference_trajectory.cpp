@@ -170,24 +170,10 @@ returnValue StaticReferenceTrajectory::getReference(	double tStart,
 	
 //     return yRef.evaluate( tStart,tEnd,_yRef );
 
-	if ( acadoIsSmaller( tEnd,yRef.getLastTime() ) == BT_TRUE )
-	{
-		_yRef = yRef.getTimeSubGrid( tStart,tEnd );
-	}
-	else
-	{
-		// constant extrapolation beyond end of interval
-		if ( acadoIsSmaller( yRef.getLastTime(),tStart ) == BT_TRUE )
-		{
-			Grid grid( tStart,tEnd );
-			_yRef.init( yRef.getLastVector(),grid );
-		}
-		else
-		{
-			_yRef = yRef.getTimeSubGrid( tStart,yRef.getLastTime() );
-			_yRef.setTime( _yRef.getLastIndex(),tEnd );
-		}
-	}
+	// constant extrapolation beyond end of interval; assigning the view
+	// reuses the memory of _yRef if its dimensions do not change
+	yRefWindow.init( yRef,tStart,tEnd,BT_TRUE );
+	_yRef = yRefWindow;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -34,7 +34,7 @@
 #define ACADO_TOOLKIT_STATIC_REFERENCE_TRAJECTORY_HPP
 
 
-#include <acado/variables_grid/variables_grid.hpp>
+#include <acado/variables_grid/variables_grid_view.hpp>
 #include <acado/curve/curve.hpp>
 #include <acado/reference_trajectory/reference_trajectory.hpp>
 
@@ -198,6 +198,7 @@ class StaticReferenceTrajectory : public ReferenceTrajectory
 
 // 		Curve yRef;
  		VariablesGrid yRef;				/** Pre-defined static reference trajectory. */
+ 		mutable VariablesGridView yRefWindow;	/** Window of last reference evaluation (speeds up search for subsequent ones). */
 };
 
 
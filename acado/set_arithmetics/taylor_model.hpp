@@ -36,6 +36,8 @@
 
 #include <acado/utils/acado_utils.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -180,6 +182,49 @@ private:
   //! @brief Variable scaling
   double *_scaling; 
 
+  //! @brief Arena providing the coefficient storage of the variables in the model
+  class Arena
+  {
+  public:
+    //! @brief Constructor for blocks of <a>ncoef_</a> coefficients and <a>nbnd_</a> bounds
+    Arena
+      ( const unsigned int ncoef_, const unsigned int nbnd_ ):
+      _ncoef( ncoef_ ), _nbnd( nbnd_ ), _nused( 0 ), _orphaned( false )
+      {}
+    //! @brief Destructor
+    ~Arena();
+    //! @brief Hand out storage for the coefficients and the bounds of a variable
+    void acquire
+      ( double*&coefmon, T*&bndord );
+    //! @brief Take back storage previously handed out; deletes an orphaned arena once all storage is back
+    void release
+      ( double*coefmon, T*bndord );
+    //! @brief Detach the arena from its TaylorModel; it is deleted as soon as all storage is back
+    void orphan();
+
+  private:
+    //! @brief Number of coefficients and bounds per variable
+    unsigned int _ncoef, _nbnd;
+    //! @brief Number of blocks currently handed out
+    unsigned int _nused;
+    //! @brief Has the owning TaylorModel been destroyed?
+    bool _orphaned;
+    //! @brief Blocks available for reuse
+    std::vector<double*> _freecoef;
+    std::vector<T*> _freebnd;
+    //! @brief Chunks of memory the blocks are carved from
+    std::vector<double*> _chunkcoef;
+    std::vector<T*> _chunkbnd;
+
+    Arena
+      ( const Arena& );
+    Arena& operator=
+      ( const Arena& );
+  };
+
+  //! @brief Arena for the coefficients of all variables in the model (avoids dynamic allocation per operation)
+  Arena* _arena;
+
   //! @brief Taylor variable to speed-up computations and reduce dynamic allocation
   TaylorVariable<T>* _TV;
 
@@ -55,6 +55,7 @@ TaylorModel<T>::_size
   _scaling = new double[_nvar];
   _modvar = true;
 
+  _arena = new Arena( _nmon, _nord+2 );
   _TV = new TaylorVariable<T>( this );
 }
 
@@ -233,6 +234,52 @@ TaylorModel<T>::_cleanup()
   delete[] _scaling;
   delete[] _binom;
   delete _TV;
+  _arena->orphan();
+}
+
+template <typename T> inline
+TaylorModel<T>::Arena::~Arena()
+{
+  for( unsigned int i=0; i<_chunkcoef.size(); i++ ) delete[] _chunkcoef[i];
+  for( unsigned int i=0; i<_chunkbnd.size(); i++ ) delete[] _chunkbnd[i];
+}
+
+template <typename T> inline void
+TaylorModel<T>::Arena::acquire
+( double*&coefmon, T*&bndord )
+{
+  if( _freecoef.empty() ){
+    // Allocate a new chunk, twice as large as the total capacity so far
+    unsigned int nblk = ( _nused? _nused: 8 );
+    double*pcoef = new double[nblk*_ncoef];
+    T*pbnd = new T[nblk*_nbnd];
+    _chunkcoef.push_back( pcoef );
+    _chunkbnd.push_back( pbnd );
+    for( unsigned int i=nblk; i>0; i-- ){
+      _freecoef.push_back( pcoef + (i-1)*_ncoef );
+      _freebnd.push_back( pbnd + (i-1)*_nbnd );
+    }
+  }
+  coefmon = _freecoef.back(); _freecoef.pop_back();
+  bndord  = _freebnd.back();  _freebnd.pop_back();
+  _nused++;
+}
+
+template <typename T> inline void
+TaylorModel<T>::Arena::release
+( double*coefmon, T*bndord )
+{
+  _freecoef.push_back( coefmon );
+  _freebnd.push_back( bndord );
+  _nused--;
+  if( _orphaned && !_nused ) delete this;
+}
+
+template <typename T> inline void
+TaylorModel<T>::Arena::orphan()
+{
+  if( !_nused ){ delete this; return; }
+  _orphaned = true;
 }
 
 template <typename T> template< typename U > inline void
@@ -249,7 +296,7 @@ TaylorModel<T>::_display
   }
   os << std::endl;
 
-  if( os == std::cout || os == std::cerr ) pause();
+  if( &os == &std::cout || &os == &std::cerr ) pause();
 }
 
 template <typename T> void
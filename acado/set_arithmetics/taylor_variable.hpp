@@ -36,6 +36,8 @@
 
 #include <acado/utils/acado_utils.hpp>
 
+#include <utility>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -202,9 +204,15 @@ public:
   template <typename U> TaylorVariable
     ( TaylorModel<T>*&TM, const TaylorVariable<U>&TV, T (*method)( const U& ) );
 
+#ifdef ACADO_HAS_CXX11
+  //! @brief Move constructor, takes over the coefficient storage of <a>TV</a>
+  TaylorVariable
+    ( TaylorVariable<T>&&TV );
+#endif
+
   //! @brief Class destructor
   ~TaylorVariable()
-    { delete [] _coefmon; delete [] _bndord; }
+    { _clean(); }
 
   //! @brief Set the index and range for the variable <a>ivar</a>, that belongs to the interval <a>X</a>.
   TaylorVariable<T>& set
@@ -283,6 +291,10 @@ public:
     ( const double );
   TaylorVariable<T>& operator =
     ( const TaylorVariable<T>& );
+#ifdef ACADO_HAS_CXX11
+  TaylorVariable<T>& operator =
+    ( TaylorVariable<T>&& );
+#endif
   TaylorVariable<T>& operator =
     ( const T& );
   template <typename U> TaylorVariable<T>& operator +=
@@ -327,6 +339,8 @@ private:
   TaylorVariable
     ( TaylorModel<T>*TM, const T&B );
 
+  //! @brief Arena of the TaylorModel providing _coefmon and _bndord (NULL if not linked to a TaylorModel)
+  typename TaylorModel<T>::Arena *_arena;
   //! @brief Coefficients for monomial terms 1,...,nmon
   double *_coefmon;
   //! @brief Bounds for individual terms of degrees 0,...,_nord+1
@@ -335,6 +349,9 @@ private:
   T * _bndrem;
   //! @brief Interval bound evaluated in T arithmetic
   T _bndT;
+  //! @brief Storage of _coefmon and _bndord for a scalar or a range not linked to a TaylorModel
+  double _coefscal;
+  T _bndscal;
 
   //! @brief Initialize private members
   void _init();
@@ -342,6 +359,11 @@ private:
   void _reinit();
   //! @brief Clean private members
   void _clean();
+#ifdef ACADO_HAS_CXX11
+  //! @brief Take over the coefficient storage of <a>TV</a>, leaving <a>TV</a> as the scalar 0
+  void _steal
+    ( TaylorVariable<T>&TV );
+#endif
 
   //! @brief Update _bndord w/ (naive) bounds for individual terms of degrees 0,...,_nord()
   void _update_bndord();
@@ -136,6 +136,28 @@ TaylorVariable<T>::operator =
   return *this;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline
+TaylorVariable<T>::TaylorVariable
+( TaylorVariable<T>&&TV )
+: _TM(0)
+{
+  _init();
+  if( !TV._TM ){ *this = TV; return; }
+  _steal( TV );
+}
+
+template <typename T> inline TaylorVariable<T>&
+TaylorVariable<T>::operator =
+( TaylorVariable<T>&&TV )
+{
+  if( this == &TV || !TV._TM ) return *this = TV;
+  _clean();
+  _steal( TV );
+  return *this;
+}
+#endif
+
 template <typename T> template <typename U> inline
 TaylorVariable<T>::TaylorVariable
 ( TaylorModel<T>*&TM, const TaylorVariable<U>&TV )
@@ -254,23 +276,37 @@ template <typename T> inline void
 TaylorVariable<T>::_init()
 {
   if( !_TM ){
-    _coefmon = new double[1];
-    _bndord  = new T[1];
+    _arena   = 0;
+    _coefmon = &_coefscal;
+    _bndord  = &_bndscal;
     _bndrem  = _bndord;
     return;
   }
-  _coefmon = new double[_nmon()];
-  _bndord  = new T[_nord()+2];
+  _arena = _TM->_arena;
+  _arena->acquire( _coefmon, _bndord );
   _bndrem  = _bndord + _nord()+1;
 }
 
 template <typename T> inline void
 TaylorVariable<T>::_clean()
 {
-  delete [] _coefmon; delete [] _bndord;
-  _coefmon = 0; _bndord = _bndrem = 0;
+  if( _arena ) _arena->release( _coefmon, _bndord );
+  _arena = 0; _coefmon = 0; _bndord = _bndrem = 0;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline void
+TaylorVariable<T>::_steal
+( TaylorVariable<T>&TV )
+{
+  _TM = TV._TM; _arena = TV._arena;
+  _coefmon = TV._coefmon; _bndord = TV._bndord; _bndrem = TV._bndrem;
+  _bndT = TV._bndT;
+  TV._TM = 0; TV._init();
+  TV._coefmon[0] = 0.; TV._bndord[0] = 0.;
+}
+#endif
+
 template <typename T> inline void
 TaylorVariable<T>::_reinit()
 {
@@ -639,6 +675,32 @@ operator +
   return TV3;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline TaylorVariable<T>
+operator +
+( TaylorVariable<T>&&TV1, const TaylorVariable<T>&TV2 )
+{
+  TV1 += TV2;
+  return std::move( TV1 );
+}
+
+template <typename T> inline TaylorVariable<T>
+operator +
+( TaylorVariable<T>&&TV1, const double c )
+{
+  TV1 += c;
+  return std::move( TV1 );
+}
+
+template <typename T> inline TaylorVariable<T>
+operator +
+( const double c, TaylorVariable<T>&&TV2 )
+{
+  TV2 += c;
+  return std::move( TV2 );
+}
+#endif
+
 template <typename T> template <typename U> inline TaylorVariable<T>&
 TaylorVariable<T>::operator +=
 ( const U&I )
@@ -740,6 +802,24 @@ operator -
   return TV3;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline TaylorVariable<T>
+operator -
+( TaylorVariable<T>&&TV1, const TaylorVariable<T>&TV2 )
+{
+  TV1 -= TV2;
+  return std::move( TV1 );
+}
+
+template <typename T> inline TaylorVariable<T>
+operator -
+( TaylorVariable<T>&&TV1, const double c )
+{
+  TV1 -= c;
+  return std::move( TV1 );
+}
+#endif
+
 template <typename T> inline TaylorVariable<T>
 operator -
 ( const double c, const TaylorVariable<T>&TV2 )
@@ -900,6 +980,24 @@ operator *
   return TV3;
 }
 
+#ifdef ACADO_HAS_CXX11
+template <typename T> inline TaylorVariable<T>
+operator *
+( TaylorVariable<T>&&TV1, const double c )
+{
+  TV1 *= c;
+  return std::move( TV1 );
+}
+
+template <typename T> inline TaylorVariable<T>
+operator *
+( const double c, TaylorVariable<T>&&TV2 )
+{
+  TV2 *= c;
+  return std::move( TV2 );
+}
+#endif
+
 template <typename T> inline TaylorVariable<T>&
 TaylorVariable<T>::operator *=
 ( const T&I )
@@ -157,18 +157,36 @@ Expression&  Expression::appendRows(const Expression& arg) {
 	return *this;
 }
 
-// this is still very unefficient code
-
 Expression& Expression::appendCols(const Expression& arg) {
 	if (getDim()==0) {operator=(arg);return *this;}
 	ASSERT(arg.getNumRows() == getNumRows());
-	
-	
-	Expression E(transpose());
-	E.appendRows(arg.transpose());
-	
-	operator=(E.transpose());
-	
+
+	if (&arg == this) {
+		Expression tmp(arg);
+		return appendCols(tmp);
+	}
+
+	uint run1, run2;
+	uint oldCols = nCols;
+
+	nCols += arg.getNumCols();
+	dim    = nRows*nCols;
+
+	variableType = VT_UNKNOWN;
+	component    = 0;
+
+	element = (Operator**)realloc(element, dim*sizeof(Operator*) );
+
+	// move the existing elements to their new (row-major) positions in place,
+	// starting from the back such that no element is overwritten before being moved
+	for( run1 = nRows; run1 > 0; run1-- )
+		for( run2 = oldCols; run2 > 0; run2-- )
+			element[(run1-1)*nCols+run2-1] = element[(run1-1)*oldCols+run2-1];
+
+	for( run1 = 0; run1 < nRows; run1++ )
+		for( run2 = 0; run2 < arg.getNumCols(); run2++ )
+			element[run1*nCols+oldCols+run2] = arg.element[run1*arg.getNumCols()+run2]->clone();
+
 	return *this;
 }
 
@@ -361,6 +361,33 @@ returnValue Addition::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Addition::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( 2*nDirs );
+    double *dArg1 = &dargument_vector[0];
+    double *dArg2 = &dargument_vector[nDirs];
+
+    argument1->AD_forward( number, nDirs, seed, dArg1 );
+    argument2->AD_forward( number, nDirs, seed, dArg2 );
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = dArg1[run1] + dArg2[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Addition::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    argument1->AD_backward( number, nDirs, seed, df );
+    argument2->AD_backward( number, nDirs, seed, df );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Addition::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
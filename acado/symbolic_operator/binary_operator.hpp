@@ -480,6 +480,10 @@ protected:
 
     int     bufferSize       ;    /**< The size of the buffer.    */
 
+    std::vector< double > dargument_vector; /**< Work space for the
+                                             *   derivatives of both
+                                             *   summands in vector mode. */
+
     CurvatureType     curvature   ;
     MonotonicityType  monotonicity;
 };
@@ -379,6 +379,33 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDirs       \n
+     *  directions at once (vector mode) based on buffered values \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDirs   /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the nDirs derivatives
+                                                          of the expression    */  );
+
+
+
+    /** Automatic Differentiation in backward mode for nDirs      \n
+     *  directions at once (vector mode) based on buffered values \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer
+                                                          position          */,
+                                      int     nDirs  /**< number of directions */,
+                                      double *seed   /**< the nDirs seeds      */,
+                                      double *df     /**< the derivative of
+                                                          the expression    */);
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -511,6 +511,18 @@ returnValue Operator::ADsymCommon2( Operator       *a  ,
 }
 
 
+returnValue Operator::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
+returnValue Operator::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
 BooleanType Operator::isTrivial() const {
 	return BT_FALSE;
 }
@@ -412,6 +412,39 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDirs       \n
+     *  directions at once (vector mode). The seed stores the     \n
+     *  nDirs tangents of each variable contiguously, i.e.        \n
+     *  seed[i*nDirs+k] is the k-th tangent of variable i.        \n
+     *  This function uses the intermediate results from a buffer \n
+     *  (run evaluate first) but does not store any derivatives.  \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NOT_IMPLEMENTED_YET                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDirs   /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the nDirs derivatives
+                                                          of the expression    */  );
+
+
+
+    /** Automatic Differentiation in backward mode for nDirs      \n
+     *  directions at once (vector mode). The derivatives are     \n
+     *  added to df, where df[i*nDirs+k] belongs to variable i    \n
+     *  and direction k.                                          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NOT_IMPLEMENTED_YET                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer
+                                                          position          */,
+                                      int     nDirs  /**< number of directions */,
+                                      double *seed   /**< the nDirs seeds      */,
+                                      double *df     /**< the derivative of
+                                                          the expression    */);
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
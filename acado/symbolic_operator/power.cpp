@@ -507,6 +507,49 @@ returnValue Power::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Power::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( 2*nDirs );
+    double *dArg1 = &dargument_vector[0];
+    double *dArg2 = &dargument_vector[nDirs];
+
+    argument1->AD_forward( number, nDirs, seed, dArg1 );
+    argument2->AD_forward( number, nDirs, seed, dArg2 );
+
+    const double c1 = argument2_result[number]*pow(argument1_result[number],argument2_result[number]-1.0);
+    const double c2 = pow(argument1_result[number],argument2_result[number])*log(argument1_result[number]);
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = c1*dArg1[run1] + c2*dArg2[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Power::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    const double c1 = argument2_result[number]*pow(argument1_result[number],argument2_result[number]-1.0);
+    const double c2 = pow(argument1_result[number],argument2_result[number])*log(argument1_result[number]);
+
+    dargument_vector.resize( nDirs );
+    double *seed_ = &dargument_vector[0];
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        seed_[run1] = c1*seed[run1];
+    argument1->AD_backward( number, nDirs, seed_, df );
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        seed_[run1] = c2*seed[run1];
+    argument2->AD_backward( number, nDirs, seed_, df );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue Power::AD_forward2( int number, double *seed, double *dseed,
                                 double *df, double *ddf ){
@@ -482,6 +482,36 @@ returnValue Power_Int::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Power_Int::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( nDirs );
+    argument->AD_forward( number, nDirs, seed, &dargument_vector[0] );
+
+    const double c = exponent*pow( argument_result[number],exponent-1 );
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = c*dargument_vector[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Power_Int::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    const double c = exponent*pow( argument_result[number],exponent-1 );
+
+    dargument_vector.resize( nDirs );
+    for( run1 = 0; run1 < nDirs; run1++ )
+        dargument_vector[run1] = c*seed[run1];
+
+    return argument->AD_backward( number, nDirs, &dargument_vector[0], df );
+}
+
+
 returnValue Power_Int::AD_forward2( int number, double *seed, double *dseed,
                                     double *df, double *ddf ){
 
@@ -316,6 +316,33 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDirs       \n
+     *  directions at once (vector mode) based on buffered values \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDirs   /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the nDirs derivatives
+                                                          of the expression    */  );
+
+
+
+    /** Automatic Differentiation in backward mode for nDirs      \n
+     *  directions at once (vector mode) based on buffered values \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer
+                                                          position          */,
+                                      int     nDirs  /**< number of directions */,
+                                      double *seed   /**< the nDirs seeds      */,
+                                      double *df     /**< the derivative of
+                                                          the expression    */);
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -473,6 +500,10 @@ protected:
 
     int     bufferSize       ;   /**< The size of the buffer   */
 
+    std::vector< double > dargument_vector; /**< Work space for the
+                                             *  derivatives in vector
+                                             *  mode.                   */
+
     CurvatureType     curvature   ;
     MonotonicityType  monotonicity;
 };
@@ -406,6 +406,46 @@ returnValue Product::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Product::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( 2*nDirs );
+    double *dArg1 = &dargument_vector[0];
+    double *dArg2 = &dargument_vector[nDirs];
+
+    argument1->AD_forward( number, nDirs, seed, dArg1 );
+    argument2->AD_forward( number, nDirs, seed, dArg2 );
+
+    const double a1 = argument1_result[number];
+    const double a2 = argument2_result[number];
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = a2*dArg1[run1] + a1*dArg2[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Product::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( nDirs );
+    double *seed_ = &dargument_vector[0];
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        seed_[run1] = argument2_result[number]*seed[run1];
+    argument1->AD_backward( number, nDirs, seed_, df );
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        seed_[run1] = argument1_result[number]*seed[run1];
+    argument2->AD_backward( number, nDirs, seed_, df );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Product::AD_forward2( int number, double *seed, double *dseed,
                                   double *df, double *ddf ){
 
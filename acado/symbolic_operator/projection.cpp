@@ -357,6 +357,28 @@ returnValue Projection::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Projection::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = seed[variableIndex*nDirs+run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Projection::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[variableIndex*nDirs+run1] += seed[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Projection::AD_forward2( int number, double *seed, double *dseed,
                                            double *df, double *ddf ){
 
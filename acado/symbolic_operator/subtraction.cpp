@@ -363,6 +363,41 @@ returnValue Subtraction::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Subtraction::AD_forward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( 2*nDirs );
+    double *dArg1 = &dargument_vector[0];
+    double *dArg2 = &dargument_vector[nDirs];
+
+    argument1->AD_forward( number, nDirs, seed, dArg1 );
+    argument2->AD_forward( number, nDirs, seed, dArg2 );
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        df[run1] = dArg1[run1] - dArg2[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Subtraction::AD_backward( int number, int nDirs, double *seed, double *df ){
+
+    int run1;
+
+    dargument_vector.resize( nDirs );
+    double *seed2 = &dargument_vector[0];
+
+    for( run1 = 0; run1 < nDirs; run1++ )
+        seed2[run1] = -seed[run1];
+
+    argument1->AD_backward( number, nDirs, seed , df );
+    argument2->AD_backward( number, nDirs, seed2, df );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Subtraction::AD_forward2( int number, double *seed, double *dseed,
                                       double *df, double *ddf ){
 
@@ -287,6 +287,27 @@ public:
                                      double  *df   /**< the derivative      */ );
 
 
+
+    /** Automatic Differentiation in forward mode for nDirs directions at once
+     *  (vector mode) based on buffered values
+     *  \return SUCCESFUL_RETURN
+     */
+    virtual returnValue AD_forward( int    number /**< the buffer position   */,
+                                    int    nDirs  /**< number of directions  */,
+                                    double *seed  /**< the seeds             */,
+                                    double *df    /**< the nDirs derivatives */ );
+
+
+    /** Automatic Differentiation in backward mode for nDirs directions at once
+     *  (vector mode) based on buffered values
+     *  \return SUCCESFUL_RETURN
+     */
+    virtual returnValue AD_backward( int    number /**< the buffer position  */,
+                                     int    nDirs  /**< number of directions */,
+                                     double *seed  /**< the nDirs seeds      */,
+                                     double *df    /**< the derivative       */ );
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -463,6 +484,8 @@ protected:
     double   *dargument_result;     /**< The results for the first derivative */
     int       bufferSize      ;     /**< The size of the buffer               */
 
+    std::vector< double > dargument_vector; /**< Work space for the derivatives in vector mode */
+
     CurvatureType     curvature   ;
     MonotonicityType  monotonicity;
     OperatorName      operatorName;
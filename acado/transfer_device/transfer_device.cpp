@@ -219,24 +219,26 @@ returnValue TransferDevice::generateNoise(	double startTime,
 	}
 
 	// generate current noise
-	DVector noiseVector( 1 );
-
 	currentNoise.init( getDim( ),noiseGrid );
 	currentNoise.setZero( );
 
-	if ( additiveNoise != 0 )
+	uint nPoints = currentNoise.getNumPoints( );
+
+	if ( ( additiveNoise != 0 ) && ( nPoints > 1 ) )
 	{
-		// generate noise
+		// generate noise of each component for all but the last grid point at once
+		VariablesGrid componentNoise( 1,nPoints-1 );
+
 		for( uint i=0; i<getDim( ); ++i )
 		{
 			if ( additiveNoise[i] != 0 )
 			{
-				for( uint j=0; j<currentNoise.getNumPoints( )-1; ++j )
-				{
-					additiveNoise[i]->step( noiseVector );
-					currentNoise( j,i ) = noiseVector( 0 );
-				}
-				currentNoise( currentNoise.getNumPoints( )-1,i ) = noiseVector( 0 );
+				if ( additiveNoise[i]->step( componentNoise ) != SUCCESSFUL_RETURN )
+					return ACADOERROR( RET_GENERATING_NOISE_FAILED );
+
+				for( uint j=0; j<nPoints-1; ++j )
+					currentNoise( j,i ) = componentNoise( j,0 );
+				currentNoise( nPoints-1,i ) = componentNoise( nPoints-2,0 );
 			}
 		}
 	}
@@ -451,6 +451,13 @@ class AlgorithmicBase
 		inline BooleanType haveOptionsChanged(	uint idx
 												) const;
 
+		/** Returns a counter that changes whenever an option value is modified.
+		 *	Derived classes may use it to refresh cached option values lazily.
+		 *
+		 *	\return Current revision of all option lists
+		 */
+		inline uint getOptionsRevision( ) const;
+
 
 		/** Sets all numerical values at all time instants of all items
 		 *	with given name within all records.
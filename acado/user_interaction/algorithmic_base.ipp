@@ -173,6 +173,12 @@ inline BooleanType AlgorithmicBase::haveOptionsChanged(	uint idx
 }
 
 
+inline uint AlgorithmicBase::getOptionsRevision( ) const
+{
+	return userInteraction->getOptionsRevision( );
+}
+
+
 
 inline returnValue AlgorithmicBase::setAll(	LogName _name,
 											const MatrixVariablesGrid& values
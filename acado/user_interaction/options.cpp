@@ -273,6 +273,17 @@ BooleanType Options::haveOptionsChanged(	uint idx
 }
 
 
+uint Options::getOptionsRevision( ) const
+{
+	uint revision = 0;
+
+	for( uint i=0; i<getNumOptionsLists( ); ++i )
+		revision += lists[i].getRevision( );
+
+	return revision;
+}
+
+
 returnValue Options::declareOptionsUnchanged( )
 {
 	returnValue returnvalue;
@@ -364,6 +364,14 @@ class Options
 										) const;
 
 
+		/** Returns a counter that changes whenever an option value of any
+		 *	option list is modified, e.g. by set() or setOptions().
+		 *
+		 *	\return Current revision of all option lists
+		 */
+		uint getOptionsRevision( ) const;
+
+
 		/** Declares all options of all option lists to be unchanged.
 		 *
 		 *  \return SUCCESSFUL_RETURN
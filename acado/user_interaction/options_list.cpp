@@ -48,13 +48,20 @@ BEGIN_NAMESPACE_ACADO
 OptionsList::OptionsList( )
 {
 	optionsHaveChanged = BT_FALSE;
+	revision = 0;
+	numItems = 0;
 }
 
 
 OptionsList::OptionsList( const OptionsList& rhs )
 {
 	optionsHaveChanged = rhs.optionsHaveChanged;
-	items = rhs.items;
+	revision = rhs.revision;
+
+	intItems = rhs.intItems;
+	doubleItems = rhs.doubleItems;
+	stringItems = rhs.stringItems;
+	numItems = rhs.numItems;
 }
 
 
@@ -67,7 +74,13 @@ OptionsList& OptionsList::operator=( const OptionsList& rhs )
 	if ( this != &rhs )
 	{
 		optionsHaveChanged = rhs.optionsHaveChanged;
-		items = rhs.items;
+		// The assigned values may differ from the current ones
+		revision = (revision > rhs.revision ? revision : rhs.revision) + 1;
+
+		intItems = rhs.intItems;
+		doubleItems = rhs.doubleItems;
+		stringItems = rhs.stringItems;
+		numItems = rhs.numItems;
 	}
 
 	return *this;
@@ -76,33 +89,26 @@ OptionsList& OptionsList::operator=( const OptionsList& rhs )
 
 returnValue OptionsList::printOptionsList( ) const
 {
-	cout << "\nThis class provides the following" << items.size() << "user options:\n";
+	cout << "\nThis class provides the following" << numItems << "user options:\n";
 
-	OptionItems::const_iterator it;
-	for (it = items.begin(); it != items.end(); ++it)
-	{
-		cout << "  --> set( \" ";
-		switch (it->first.second)
-		{
-		case OIT_INT:
-			cout << "\", <int>    );  current value: ";
-			break;
+	uint maxName = intItems.defined.size();
+	if ( doubleItems.defined.size() > maxName )
+		maxName = doubleItems.defined.size();
+	if ( stringItems.defined.size() > maxName )
+		maxName = stringItems.defined.size();
 
-		case OIT_DOUBLE:
-			cout << "\", <double> );  current value: ";
-			break;
-
-		case OIT_STRING:
-			cout << "\", <string> );  current value: ";
-			break;
+	for (uint i = 0; i < maxName; ++i)
+	{
+		OptionsName name = (OptionsName)i;
 
-		default:
-			return ACADOERROR(RET_UNKNOWN_BUG);
+		if (intItems.has( name ) == true)
+			cout << "  --> set( \" \", <int>    );  current value: " << intItems.values[ i ] << endl;
 
-		}
+		if (doubleItems.has( name ) == true)
+			cout << "  --> set( \" \", <double> );  current value: " << doubleItems.values[ i ] << endl;
 
-		it->second->print( cout );
-		cout << endl;
+		if (stringItems.has( name ) == true)
+			cout << "  --> set( \" \", <string> );  current value: " << stringItems.values[ i ] << endl;
 	}
 
 	cout << endl;
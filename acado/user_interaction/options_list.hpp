@@ -34,12 +34,7 @@
 
 #include <acado/utils/acado_utils.hpp>
 
-#include <map>
-#ifdef _WIN32
-    #include <memory>
-#else
-    #include <tr1/memory>
-#endif
+#include <vector>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -99,7 +94,8 @@ class OptionsList
 		OptionsList& operator=(	const OptionsList& rhs
 								);
 
-		/** Add an option item with a given value.
+		/** Add an option item with a given value. Adding an existing option
+		 *	item overwrites its value and increases the revision.
 		 *
 		 *  @tparam    T		Option data type.
 		 *	@param[in] name		Name of new option item.
@@ -175,6 +171,14 @@ class OptionsList
 		 */
 		inline returnValue declareOptionsUnchanged( );
 
+		/** Returns a counter that is increased whenever the value of an option
+		 *	item is modified. Algorithms may cache option values and refresh them
+		 *	only if the counter differs from the one seen at caching time.
+		 *
+		 *	\return Current revision of the options list
+		 */
+		inline uint getRevision( ) const;
+
 
 		/** Prints a list of all available options.
 		 *
@@ -190,35 +194,43 @@ class OptionsList
 		/** Flag indicating whether the value of at least one option item has been changed. */
 		BooleanType optionsHaveChanged;
 
-		/** Value base type */
-		struct OptionValueBase
-		{
-			virtual void print( std::ostream& stream ) = 0;
-		};
+		/** Counter that is increased whenever the value of an option item is modified. */
+		uint revision;
 
-		/** Value type */
+		/** Option items of one type, stored in slots indexed by the option name.
+		 *	Looking up an option is therefore a constant-time array access. */
 		template< typename T >
-		struct OptionValue : public OptionValueBase
+		struct OptionSlots
 		{
-			OptionValue( const T& _value )
-				: value( _value )
-			{}
+			std::vector< T > values;
+			std::vector< bool > defined;
 
-			virtual void print( std::ostream& stream )
+			inline bool has( OptionsName name ) const
 			{
-				stream << value;
+				return ((uint)name < defined.size()) && (defined[ name ] == true);
 			}
-
-			T value;
 		};
 
-		/** Type for options items. */
-		typedef std::map<std::pair<OptionsName, OptionsItemType>, std::tr1::shared_ptr< OptionValueBase > > OptionItems;
-		/** Option items. */
-		OptionItems items;
+		/** Option items of integer type. */
+		OptionSlots< int > intItems;
+		/** Option items of double type. */
+		OptionSlots< double > doubleItems;
+		/** Option items of std::string type. */
+		OptionSlots< std::string > stringItems;
+		/** Total number of option items. */
+		uint numItems;
+
 		/** A helper function to determine type of an option. */
 		template< typename T >
 		inline OptionsItemType getType() const;
+
+		/** A helper function returning the slots of a given option type. */
+		template< typename T >
+		inline OptionSlots< T >* getSlots();
+
+		/** A helper function returning the slots of a given option type. */
+		template< typename T >
+		inline const OptionSlots< T >* getSlots() const;
 };
 
 template< typename T >
@@ -237,16 +249,54 @@ template<>
 inline OptionsItemType OptionsList::getType< std::string >() const
 { return OIT_STRING; }
 
+template< typename T >
+inline OptionsList::OptionSlots< T >* OptionsList::getSlots()
+{ return 0; }
+
+template<>
+inline OptionsList::OptionSlots< int >* OptionsList::getSlots< int >()
+{ return &intItems; }
+
+template<>
+inline OptionsList::OptionSlots< double >* OptionsList::getSlots< double >()
+{ return &doubleItems; }
+
+template<>
+inline OptionsList::OptionSlots< std::string >* OptionsList::getSlots< std::string >()
+{ return &stringItems; }
+
+template< typename T >
+inline const OptionsList::OptionSlots< T >* OptionsList::getSlots() const
+{ return const_cast< OptionsList* >( this )->getSlots< T >(); }
+
 template< typename T >
 inline returnValue OptionsList::add(	OptionsName name,
 										const T& value
 										)
 {
-	if (getType< T >() == OIT_UNKNOWN)
+	OptionSlots< T >* slots = getSlots< T >();
+	if (slots == 0)
 		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 
-	items[ std::make_pair(name, getType< T >()) ] =
-			std::tr1::shared_ptr< OptionValue< T > > (new OptionValue< T >( value ));
+	if ((uint)name >= slots->defined.size())
+	{
+		slots->values.resize(name + 1);
+		slots->defined.resize(name + 1, false);
+	}
+
+	if (slots->defined[ name ] == false)
+	{
+		++numItems;
+	}
+	else
+	{
+		// overwriting an existing option counts as a modification
+		optionsHaveChanged = BT_TRUE;
+		++revision;
+	}
+
+	slots->values[ name ] = value;
+	slots->defined[ name ] = true;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -256,15 +306,13 @@ inline returnValue OptionsList::get(	OptionsName name,
 										T& value
 										) const
 {
-	if (getType< T >() == OIT_UNKNOWN)
+	const OptionSlots< T >* slots = getSlots< T >();
+	if (slots == 0)
 		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 
-	OptionItems::const_iterator it = items.find(std::make_pair(name, getType< T >()));
-	if (it != items.end())
+	if (slots->has( name ) == true)
 	{
-		std::tr1::shared_ptr< OptionValue< T > > ptr;
-		ptr = std::tr1::static_pointer_cast< OptionValue< T > >(it->second);
-		value = ptr->value;
+		value = slots->values[ name ];
 		return SUCCESSFUL_RETURN;
 	}
 
@@ -276,16 +324,16 @@ inline returnValue OptionsList::set(	OptionsName name,
 										const T& value
 										)
 {
-	if (getType< T >() == OIT_UNKNOWN)
+	OptionSlots< T >* slots = getSlots< T >();
+	if (slots == 0)
 		return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 
-	OptionItems::const_iterator it = items.find(std::make_pair(name, getType< T >()));
-	if (it != items.end())
+	if (slots->has( name ) == true)
 	{
-		items[ std::make_pair(name, getType< T >()) ] =
-				std::tr1::shared_ptr< OptionValue< T > > (new OptionValue< T >( value ));
+		slots->values[ name ] = value;
 
 		optionsHaveChanged = BT_TRUE;
+		++revision;
 
 		return SUCCESSFUL_RETURN;
 	}
@@ -43,7 +43,7 @@ BEGIN_NAMESPACE_ACADO
 
 inline uint OptionsList::getNumber( ) const
 {
-	return items.size();
+	return numItems;
 }
 
 
@@ -51,11 +51,20 @@ inline BooleanType OptionsList::hasOption(	OptionsName name,
 											OptionsItemType type
 											) const
 {
-	OptionItems::const_iterator it = items.find(std::make_pair(name, type));
-	if (it != items.end())
-		return true;
-		
-	return false;
+	switch ( type )
+	{
+		case OIT_INT:
+			return intItems.has( name );
+
+		case OIT_DOUBLE:
+			return doubleItems.has( name );
+
+		case OIT_STRING:
+			return stringItems.has( name );
+
+		default:
+			return false;
+	}
 }
 
 
@@ -72,6 +81,12 @@ inline returnValue OptionsList::declareOptionsUnchanged( )
 }
 
 
+inline uint OptionsList::getRevision( ) const
+{
+	return revision;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -45,8 +45,9 @@ const double 	defaultKKTtolerance = 1.0e-6;										/**< Default value for the
 const double 	defaultKKTtoleranceSafeguard = 1.0;									/**< Default value for safeguarding the KKT tolerance as termination criterium for the NLP solver (possible values: any non-negative real number). */
 const double 	defaultLevenbergMarguardt = 0.0;									/**< Default value for Levenberg-Marquardt regularization (possible values: any non-negative real number). */
 const double 	defaultHessianProjectionFactor = 1.0;								/**< Default value for projecting semi-definite Hessians to positive definite part (possible values: any positive real number). */
-const int 		defaultHessianApproximation = BLOCK_BFGS_UPDATE;					/**< Default value for approximating the Hessian within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION). */
-const int 		defaultDynamicHessianApproximation = DEFAULT_HESSIAN_APPROXIMATION;	/**< Default value for approximating the Hessian of the dynamic equations within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION). */
+const int 		defaultHessianApproximation = BLOCK_BFGS_UPDATE;					/**< Default value for approximating the Hessian within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION, L_BFGS_UPDATE). */
+const int 		defaultDynamicHessianApproximation = DEFAULT_HESSIAN_APPROXIMATION;	/**< Default value for approximating the Hessian of the dynamic equations within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION, L_BFGS_UPDATE). */
+const int 		defaultLBFGSmemorySize = 10;										/**< Default value for the number of curvature pairs stored per block by limited-memory BFGS updates (possible values: any positive integer). */
 const int 		defaultDynamicSensitivity = BACKWARD_SENSITIVITY;					/**< Default value for generating sensitivities of the dynamic equations (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultObjectiveSensitivity = BACKWARD_SENSITIVITY;					/**< Default value for generating sensitivities of the objective function (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultConstraintSensitivity = BACKWARD_SENSITIVITY;				/**< Default value for generating sensitivities of the constraints (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
@@ -88,11 +89,13 @@ const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default valu
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultNumIntegratorThreads = 1;							/**< Default value for the number of threads integrating independent initial boxes in the validated integrator (possible values: any positive integer). */
 
 // MultiObjectiveAlgorithm
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
 const int 		defaultParetoFrontGeneration = PFG_WEIGHTED_SUM;			/**< Default value for specifying the scalarization method (possible values: PFG_FIRST_OBJECTIVE, PFG_SECOND_OBJECTIVE, PFG_WEIGHTED_SUM, PFG_NORMALIZED_NORMAL_CONSTRAINT, PFG_NORMAL_BOUNDARY_INTERSECTION, PFG_ENHANCED_NORMALIZED_NORMAL_CONSTRAINT, PFG_EPSILON_CONSTRAINT). */
 const int 		defaultParetoFrontHotstart = BT_TRUE;						/**< Default value for specifying whether hotstarts are to be used within the multi-objective optimization (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultParetoFrontNumThreads = 1;							/**< Default value for the number of Pareto points that are solved concurrently (possible values: any positive integer). */
 
 // SimulationEnvironment
 const int 		defaultSimulateComputationalDelay = BT_FALSE;				/**< Default value for specifying whether computational delays shall be simulated or not (possible values: BT_TRUE, BT_FALSE). */
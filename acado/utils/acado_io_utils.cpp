@@ -45,6 +45,7 @@
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 
 #else
@@ -194,12 +195,7 @@ returnValue acadoCopyFile(	const std::string& source,
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 	}
 
-	std::ofstream  dst( destination.c_str() );
-	if (dst.is_open() == false)
-	{
-		LOG( LVL_ERROR ) << "Could not open the destination file: " << destination << std::endl;
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
-	}
+	std::stringstream  dst;
 
 	if (printCodegenNotice == BT_TRUE)
 	{
@@ -222,7 +218,12 @@ returnValue acadoCopyFile(	const std::string& source,
 	dst << src.rdbuf();
 
 	src.close();
-	dst.close();
+
+	if (acadoWriteFileIfChanged(destination, dst.str()) != SUCCESSFUL_RETURN)
+	{
+		LOG( LVL_ERROR ) << "Could not open the destination file: " << destination << std::endl;
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+	}
 
 	return SUCCESSFUL_RETURN;
 }
@@ -260,6 +261,41 @@ returnValue acadoCopyTemplateFile(	const std::string& source,
 	return ACADOERROR( RET_INVALID_ARGUMENTS );
 }
 
+returnValue acadoWriteFileIfChanged(	const std::string& fileName,
+										const std::string& content,
+										bool* isWritten
+										)
+{
+	if (isWritten != 0)
+		*isWritten = false;
+
+	std::ifstream  old( fileName.c_str() );
+	if (old.is_open() == true)
+	{
+		std::stringstream  oldContent;
+		oldContent << old.rdbuf();
+		old.close();
+
+		if (oldContent.str() == content)
+			return SUCCESSFUL_RETURN;
+	}
+
+	std::ofstream  dst( fileName.c_str() );
+	if (dst.is_open() == false)
+		return RET_DOES_DIRECTORY_EXISTS;
+
+	dst << content;
+	dst.close();
+
+	if (dst.fail() == true)
+		return RET_DOES_DIRECTORY_EXISTS;
+
+	if (isWritten != 0)
+		*isWritten = true;
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue acadoCreateFolder(	const std::string& name
 								)
 {
@@ -330,11 +366,11 @@ returnValue acadoPrintCopyrightNotice(	const std::string& subpackage
 }
 
 
-returnValue acadoPrintAutoGenerationNotice(	std::ofstream& stream,
+returnValue acadoPrintAutoGenerationNotice(	std::ostream& stream,
 											const std::string& commentString
 											)
 {
-	if (stream.is_open() == false)
+	if (stream.good() == false)
 		return RET_INVALID_ARGUMENTS;
 
 	if (commentString.empty())
@@ -370,6 +406,10 @@ double acadoGetTime( )
 	QueryPerformanceFrequency(&frequency);
 	QueryPerformanceCounter(&counter);
 	current_time = ((double) counter.QuadPart) / ((double) frequency.QuadPart);
+	#elif defined(LINUX) && defined(CLOCK_MONOTONIC)
+	struct timespec theclock;
+	clock_gettime( CLOCK_MONOTONIC,&theclock );
+	current_time = 1.0*theclock.tv_sec + 1.0e-9*theclock.tv_nsec;
 	#elif defined(LINUX)
 	struct timeval theclock;
 	gettimeofday( &theclock,0 );
@@ -379,6 +419,35 @@ double acadoGetTime( )
 	return current_time;
 }
 
+
+/*
+ *	g e t T i m e N s
+ */
+uint64_t acadoGetTimeNs( )
+{
+	uint64_t current_time = 0;
+
+	#if defined(__WIN32__) || defined(WIN32)
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	// split the conversion to avoid overflowing the intermediate product
+	uint64_t ticks = (uint64_t)counter.QuadPart;
+	uint64_t freq  = (uint64_t)frequency.QuadPart;
+	current_time = (ticks / freq) * 1000000000ULL + ((ticks % freq) * 1000000000ULL) / freq;
+	#elif defined(LINUX) && defined(CLOCK_MONOTONIC)
+	struct timespec theclock;
+	clock_gettime( CLOCK_MONOTONIC,&theclock );
+	current_time = (uint64_t)theclock.tv_sec * 1000000000ULL + (uint64_t)theclock.tv_nsec;
+	#elif defined(LINUX)
+	struct timeval theclock;
+	gettimeofday( &theclock,0 );
+	current_time = (uint64_t)theclock.tv_sec * 1000000000ULL + (uint64_t)theclock.tv_usec * 1000ULL;
+	#endif
+
+	return current_time;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 /*
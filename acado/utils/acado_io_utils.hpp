@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <stdint.h>
 
 #include <string>
 #include <sstream>
@@ -98,6 +99,22 @@ returnValue acadoCopyTemplateFile(	const std::string& source,
 									bool printCodegenNotice = false
 									);
 
+/** Writes the given content to a file, unless the file already exists
+ *  with exactly the same content. Unchanged files are thus not touched,
+ *  which keeps timestamp-based builds of generated code incremental.
+ *
+ *  \param fileName   name of the file
+ *  \param content    content to be written
+ *  \param isWritten  output (optional): whether the file has been written
+ *
+ *  \return SUCCESSFUL_RETURN, \n
+ *          RET_DOES_DIRECTORY_EXISTS
+ */
+returnValue acadoWriteFileIfChanged(	const std::string& fileName,
+										const std::string& content,
+										bool* isWritten = 0
+										);
+
 /** A function to create a folder. */
 returnValue acadoCreateFolder(const std::string& name);
 
@@ -115,16 +132,24 @@ returnValue acadoPrintCopyrightNotice(	const std::string& subpackage
 /** Prints ACADO Toolkit's copyright notice for auto generated code.
  *
  *  \return SUCCESSFUL_RETURN */
-returnValue acadoPrintAutoGenerationNotice(	std::ofstream& stream,
+returnValue acadoPrintAutoGenerationNotice(	std::ostream& stream,
 											const std::string& commentString
 											);
 
-/** Returns the current system time.
+/** Returns the current system time. On POSIX systems a monotonic clock
+ *  is used, i.e. the returned value is not affected by adjustments of the
+ *  wall-clock time and is only meaningful for measuring time differences.
  *
- *  \return current system time
+ *  \return current system time in seconds
  */
 double acadoGetTime( );
 
+/** Returns the current value of the monotonic system clock in nanoseconds.
+ *
+ *  \return current system time in nanoseconds
+ */
+uint64_t acadoGetTimeNs( );
+
 CLOSE_NAMESPACE_ACADO
 
 namespace std
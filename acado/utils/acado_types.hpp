@@ -58,6 +58,13 @@ typedef void (*cFcnPtr)( double* x, double* f, void *userData );
 /** Function pointer type for derivatives given as C source code. */
 typedef void (*cFcnDPtr)( int number, double* x, double* seed, double* f, double* df, void *userData );
 
+/** Function pointer type for Jacobians given as C source code (row-major, dim x nx). */
+typedef void (*cFcnJacobianPtr)( double* x, double* J, void *userData );
+
+/** Function pointer type for functions given as C source code that are evaluated
+ *  at nPoints points at once (stored one after the other in x and f). */
+typedef void (*cFcnBatchPtr)( int nPoints, double* x, double* f, void *userData );
+
 /** Defines the Neutral Elements ZERO and ONE as well as the default
  *  NEITHER_ONE_NOR_ZERO
  */
@@ -339,6 +346,11 @@ enum OptionsName
 	CG_USE_C99,									/**< Code generation is allowed (or not) to export C-code that conforms C99 standard. */
 	CG_COMPUTE_COVARIANCE_MATRIX,				/**< Enable computation of the variance-covariance matrix for the last estimate. */
 	CG_HARDCODE_CONSTRAINT_VALUES,				/**< Enable/disable hard-coding of the constraint values. */
+	CG_HESSIAN_REGULARIZATION,					/**< Regularization strategy for exact Hessian blocks in the exported solver. \sa HessianRegularizationMode */
+	CG_USE_TIMING_COUNTERS,						/**< Enable/disable per-phase timing counters in the exported solver. */
+	CG_BATCH_INTEGRATOR_BLOCK_SIZE,				/**< Number of trajectories integrated in lockstep by the exported batch integrator (0 disables it). */
+	CG_USE_WORKER_POOL,							/**< Run the shooting nodes of the exported solver on persistent worker threads (requires CG_USE_OPENMP). */
+	CG_EXPORT_NUM_THREADS,						/**< Number of threads used to write the files of the exported code concurrently. */
 	IMPLICIT_INTEGRATOR_MODE,					/**< This determines the mode of the implicit integrator (see enum ImplicitIntegratorMode). */
 	LIFTED_INTEGRATOR_MODE,						/**< This determines the mode of lifting of the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS,				/**< This is the performed number of Newton iterations in the implicit integrator. */
@@ -363,6 +375,7 @@ enum OptionsName
 	ALGEBRAIC_RELAXATION,
 	RELAXATION_PARAMETER,
 	PRINT_INTEGRATOR_PROFILE,
+	NUM_INTEGRATOR_THREADS,						/**< Number of threads integrating independent initial boxes in the validated integrator. */
 	FEASIBILITY_CHECK,
 	MAX_NUM_ITERATIONS,
 	KKT_TOLERANCE,
@@ -372,6 +385,7 @@ enum OptionsName
 	PRINT_COPYRIGHT,
 	HESSIAN_APPROXIMATION,
 	DYNAMIC_HESSIAN_APPROXIMATION,
+	LBFGS_MEMORY_SIZE,
 	HESSIAN_PROJECTION_FACTOR,
 	DYNAMIC_SENSITIVITY,
 	OBJECTIVE_SENSITIVITY,
@@ -399,6 +413,7 @@ enum OptionsName
 	PARETO_FRONT_DISCRETIZATION,
 	PARETO_FRONT_GENERATION,
 	PARETO_FRONT_HOTSTART,
+	PARETO_FRONT_NUM_THREADS,
 	SIMULATION_ALGORITHM,
 	CONTROL_PLOTTING,
 	PARAMETER_PLOTTING,
@@ -613,7 +628,8 @@ enum HessianApproximationMode{
     BLOCK_BFGS_UPDATE,
     GAUSS_NEWTON_WITH_BLOCK_BFGS,
     EXACT_HESSIAN,
-    DEFAULT_HESSIAN_APPROXIMATION
+    DEFAULT_HESSIAN_APPROXIMATION,
+    L_BFGS_UPDATE
 };
 
 
@@ -805,6 +821,14 @@ enum CondensedHessianCholeskyDecomposition
 	INTERNAL_N2		/**< n-square version, performed within the exported code, and passed to a QP solver. */
 };
 
+/** Defines the regularization strategies of exported exact Hessian blocks. */
+enum HessianRegularizationMode
+{
+	EVD_MIRRORING,		/**< Full eigenvalue decomposition, mirroring of the negative eigenvalues. */
+	EVD_WARM_START,		/**< Eigenvalue decomposition warm-started by Jacobi sweeps from the previous eigenbasis of the block. */
+	CHOLESKY_SHIFT		/**< Cholesky factorization attempt, diagonal shift of the block in case it fails. */
+};
+
 /**
  *	\brief Defines all symbols for global return values.
  *
@@ -33,6 +33,10 @@
 
 #include <acado/validated_integrator/ellipsoidal_integrator.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <thread>
+#endif
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -154,15 +158,98 @@ Tmatrix<Interval> EllipsoidalIntegrator::integrate( double t0, double tf, int M,
 	
 	integrate( t0, tf, &xx, pp, ww );
 	
+	if( pp != 0 ) delete pp;
+	if( ww != 0 ) delete ww;
+	
 	return getStateBound( xx );
 }
 
 
+std::vector< Tmatrix<Interval> > EllipsoidalIntegrator::integrate( double t0, double tf, int M,
+																   const std::vector< Tmatrix<Interval> > &x ){
+
+	Tmatrix<Interval> p(0);
+	Tmatrix<Interval> w(0);
+	return integrate( t0, tf, M, x, p, w );
+}
+
+std::vector< Tmatrix<Interval> > EllipsoidalIntegrator::integrate( double t0, double tf, int M,
+																   const std::vector< Tmatrix<Interval> > &x,
+																   const Tmatrix<Interval> &p ){
+
+	Tmatrix<Interval> w(0);
+	return integrate( t0, tf, M, x, p, w );
+}
+
+std::vector< Tmatrix<Interval> > EllipsoidalIntegrator::integrate( double t0, double tf, int M,
+																   const std::vector< Tmatrix<Interval> > &x,
+																   const Tmatrix<Interval> &p,
+																   const Tmatrix<Interval> &w ){
+
+	std::vector< Tmatrix<Interval> > result( x.size() );
+
+	int numThreads;
+	get( NUM_INTEGRATOR_THREADS, numThreads );
+	if( numThreads > (int) x.size() ) numThreads = (int) x.size();
+
+	// All boxes start from the current ellipsoidal remainder:
+	Tmatrix<double> Q0( Q );
+
+#ifdef ACADO_HAS_CXX11
+	if( numThreads > 1 ){
+
+		// Each thread works on its own copy, as integrating changes the
+		// ellipsoidal remainder Q. The copies are made before any thread starts.
+		std::vector<EllipsoidalIntegrator*> workers( numThreads );
+		for( int i=0; i<numThreads; i++ ){
+			workers[i] = new EllipsoidalIntegrator( *this );
+			workers[i]->set( INTEGRATOR_PRINTLEVEL   , NONE  );
+			workers[i]->set( PRINT_INTEGRATOR_PROFILE, BT_FALSE );
+		}
+
+		std::vector<std::thread> threads;
+		for( int i=0; i<numThreads; i++ )
+			threads.push_back( std::thread( &EllipsoidalIntegrator::integrateBoxes, workers[i],
+											t0, tf, M, &x, &p, &w, &Q0, i, numThreads, &result ) );
+
+		for( int i=0; i<numThreads; i++ ){
+			threads[i].join();
+			delete workers[i];
+		}
+
+		return result;
+	}
+#endif
+
+	integrateBoxes( t0, tf, M, &x, &p, &w, &Q0, 0, 1, &result );
+
+	// Leave the remainder as on entry, as the parallel path does:
+	Q = Q0;
+
+	return result;
+}
+
+
 
 // IMPLEMENTATION OF PRIVATE MEMBER FUNCTIONS:
 // ======================================================================================
 
 
+void EllipsoidalIntegrator::integrateBoxes(	double t0, double tf, int M,
+												const std::vector< Tmatrix<Interval> >* x,
+												const Tmatrix<Interval>* p,
+												const Tmatrix<Interval>* w,
+												const Tmatrix<double>* Q0,
+												int first, int stride,
+												std::vector< Tmatrix<Interval> >* result ){
+
+	for( int i=first; i<(int) x->size(); i+=stride ){
+		Q = *Q0;
+		(*result)[i] = integrate( t0, tf, M, (*x)[i], *p, *w );
+	}
+}
+
+
 void EllipsoidalIntegrator::copy( const EllipsoidalIntegrator& arg ){
   
 	nx  = arg.nx ;
@@ -289,6 +376,7 @@ returnValue EllipsoidalIntegrator::setupOptions( ){
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
 	addOption( STEPSIZE_TUNING             , defaultStepsizeTuning          );
+	addOption( NUM_INTEGRATOR_THREADS      , defaultNumIntegratorThreads    );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -36,6 +36,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include <acado/clock/clock.hpp>
 #include <acado/utils/acado_utils.hpp>
 #include <acado/user_interaction/algorithmic_base.hpp>
@@ -91,6 +92,20 @@ class EllipsoidalIntegrator : public AlgorithmicBase
 	Tmatrix<Interval> integrate( double t0, double tf, int M, const Tmatrix<Interval> &x,
 								 const Tmatrix<Interval> &p, const Tmatrix<Interval> &w );
 	
+	/** Integrates each of the given initial boxes (e.g. the boxes of a partition of the
+	 *  initial set) independently. If the option NUM_INTEGRATOR_THREADS is larger than
+	 *  one, the boxes are distributed over as many threads.
+	 *
+	 *  \return The state enclosures at tf, one for each initial box.
+	 */
+	std::vector< Tmatrix<Interval> > integrate( double t0, double tf, int M, const std::vector< Tmatrix<Interval> > &x );
+	
+	std::vector< Tmatrix<Interval> > integrate( double t0, double tf, int M, const std::vector< Tmatrix<Interval> > &x,
+												const Tmatrix<Interval> &p );
+	
+	std::vector< Tmatrix<Interval> > integrate( double t0, double tf, int M, const std::vector< Tmatrix<Interval> > &x,
+												const Tmatrix<Interval> &p, const Tmatrix<Interval> &w );
+	
 
 	template <typename T> returnValue integrate( double t0, double tf,
 												 Tmatrix<T> *x, Tmatrix<T> *p = 0, Tmatrix<T> *w = 0 );
@@ -118,6 +133,15 @@ private:
 	
 	void copy( const EllipsoidalIntegrator& arg );
 	
+	/** Integrates the boxes first, first+stride, ... of x, each starting from the remainder Q0. */
+	void integrateBoxes(	double t0, double tf, int M,
+							const std::vector< Tmatrix<Interval> >* x,
+							const Tmatrix<Interval>* p,
+							const Tmatrix<Interval>* w,
+							const Tmatrix<double>* Q0,
+							int first, int stride,
+							std::vector< Tmatrix<Interval> >* result );
+	
 	template <typename T> void phase0( double t,
 									   Tmatrix<T> *x, Tmatrix<T> *p, Tmatrix<T> *w,
 									   Tmatrix<T> &coeff, Tmatrix<double> &C );
@@ -33,6 +33,7 @@
 
 #include <acado/variables_grid/grid.hpp>
 #include <iomanip>
+#include <algorithm>
 
 using namespace std;
 
@@ -528,6 +529,27 @@ BooleanType Grid::hasTime(	double _time
 
 
 
+BooleanType Grid::hasTime(	double _time,
+							uint& hint
+							) const
+{
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
+
+	uint idx = getCeilIndex( _time,hint );
+
+	/* preceding grid points may still be equal to given time due to relative tolerance */
+	while ( ( idx > 0 ) && ( acadoIsEqual( getTime( idx-1 ),_time ) == BT_TRUE ) )
+		--idx;
+
+	if ( findTime( _time,idx ) < 0 )
+		return BT_FALSE;
+	else
+		return BT_TRUE;
+}
+
+
+
 int Grid::findTime(	double _time,
 					uint startIdx
 					) const
@@ -652,6 +674,50 @@ uint Grid::getCeilIndex ( double time_ ) const
 }
 
 
+uint Grid::getFloorIndex(	double time_,
+							uint& hint
+							) const
+{
+	/* ensure that time lies within range */
+	if ( acadoIsGreater( getTime( 0 ) , time_ ) == BT_TRUE )
+		return ( hint = 0 );
+
+	if ( acadoIsSmaller( getTime( getLastIndex( ) ) , time_ ) == BT_TRUE )
+		return ( hint = getLastIndex( ) );
+
+	/* try interval of previous lookup and the next one */
+	if ( ( hint < getLastIndex( ) ) && ( isInUpperHalfOpenInterval( hint,time_ ) == BT_TRUE ) )
+		return hint;
+
+	if ( ( hint+1 < getLastIndex( ) ) && ( isInUpperHalfOpenInterval( hint+1,time_ ) == BT_TRUE ) )
+		return ++hint;
+
+	return ( hint = getFloorIndex( time_ ) );
+}
+
+
+uint Grid::getCeilIndex (	double time_,
+							uint& hint
+							) const
+{
+	/* ensure that time lies within range */
+	if ( acadoIsGreater( getTime( 0 ) , time_ ) == BT_TRUE )
+		return ( hint = 0 );
+
+	if ( acadoIsSmaller( getTime( getLastIndex( ) ) , time_ ) == BT_TRUE )
+		return ( hint = getLastIndex( ) );
+
+	/* try interval of previous lookup and the next one */
+	if ( ( hint > 0 ) && ( hint < getNumPoints( ) ) && ( isInLowerHalfOpenInterval( hint,time_ ) == BT_TRUE ) )
+		return hint;
+
+	if ( ( hint+1 < getNumPoints( ) ) && ( isInLowerHalfOpenInterval( hint+1,time_ ) == BT_TRUE ) )
+		return ++hint;
+
+	return ( hint = getCeilIndex( time_ ) );
+}
+
+
 returnValue Grid::getSubGrid(	double tStart,
 								double tEnd,
 								Grid& _subGrid
@@ -662,36 +728,40 @@ returnValue Grid::getSubGrid(	double tStart,
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
 
+	// determine range of grid points within [tStart,tEnd] by binary search
+	// (using the same tolerances as acadoIsGreater and acadoIsSmaller)
+	uint startIdx = (uint)( lower_bound( times,times+getNumPoints( ),tStart-EQUALITY_EPS ) - times );
+	uint endIdx   = (uint)( upper_bound( times,times+getNumPoints( ),tEnd+EQUALITY_EPS ) - times );
+
+	uint hint = startIdx;
+	BooleanType hasStartTime = hasTime( tStart,hint );
+	BooleanType hasEndTime   = hasTime( tEnd,hint );
+
 	// determine number of subpoints
 	uint nSubPoints = 0;
 
-	if ( hasTime( tStart ) == BT_FALSE )
+	if ( hasStartTime == BT_FALSE )
 		++nSubPoints;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE  &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     ) ++nSubPoints;
-	}
+	if ( endIdx > startIdx )
+		nSubPoints += endIdx-startIdx;
 
-	if ( hasTime( tEnd ) == BT_FALSE )
+	if ( hasEndTime == BT_FALSE )
 		++nSubPoints;
 
 	// setup subgrid with subpoints
 	_subGrid.init( nSubPoints );
 
-	if ( hasTime( tStart ) == BT_FALSE )
-		_subGrid.setTime( tStart );
+	uint subIdx = 0;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     )
-			_subGrid.setTime( getTime( i ) );
-	}
+	if ( hasStartTime == BT_FALSE )
+		_subGrid.setTime( subIdx++,tStart );
+
+	for( uint i=startIdx; i<endIdx; ++i )
+		_subGrid.setTime( subIdx++,getTime( i ) );
 
-	if ( hasTime( tEnd ) == BT_FALSE )
-		_subGrid.setTime( tEnd );
+	if ( hasEndTime == BT_FALSE )
+		_subGrid.setTime( subIdx++,tEnd );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -428,6 +428,20 @@ class Grid
 		BooleanType hasTime(	double _time
 								) const;
 
+		/** Returns whether the grid contains a given time point, using the index
+		 *	of a previous lookup as starting point for the search (see getFloorIndex).
+		 *	Grid points are assumed to be ordered.
+		 *
+		 *	@param[in]     _time	Time point to be checked for existence.
+		 *	@param[in,out] hint		Index of a previous lookup (or 0), updated on return.
+		 *
+		 *  \return BT_TRUE  iff grid contains given time point, \n
+		 *	        BT_FALSE otherwise
+		 */
+		BooleanType hasTime(	double _time,
+								uint& hint
+								) const;
+
 
 		/** Returns index of an grid point at given time, starting at
 		 *	startIdx.
@@ -489,6 +503,33 @@ class Grid
 		uint getCeilIndex (	double time
 							) const;
 
+		/** Returns index of grid point with greatest time smaller or equal to given time.
+		 *	The search starts at the interval of a previous lookup, which is passed as hint 
+		 *	and updated on return. If the time is not within this interval or the next 
+		 *	one, binary search is used. Thus, sequential lookups at increasing times 
+		 *	(as arising during simulation) cost amortized O(1).
+		 *
+		 *	@param[in]     time		Time greater or equal than that of the time point to be found.
+		 *	@param[in,out] hint		Index returned by a previous lookup (or 0), updated on return.
+		 *
+		 *  \return Index of grid point with greatest time smaller or equal to given time
+		 */
+		uint getFloorIndex(	double time,
+							uint& hint
+							) const;
+
+		/** Returns index of grid point with smallest time greater or equal to given time.
+		 *	The search starts at the interval of a previous lookup, see getFloorIndex.
+		 *
+		 *	@param[in]     time		Time smaller or equal than that of the time point to be found.
+		 *	@param[in,out] hint		Index returned by a previous lookup (or 0), updated on return.
+		 *
+		 *  \return Index of grid point with smallest time greater or equal to given time
+		 */
+		uint getCeilIndex (	double time,
+							uint& hint
+							) const;
+
 
 		/** Returns largest index of grid (note the difference to getNumPoints()).
 		 *
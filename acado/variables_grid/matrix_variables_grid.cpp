@@ -36,18 +36,73 @@
 #include <acado/variables_grid/variables_grid.hpp>
 
 #include <iomanip>
+#include <algorithm>
 
 using namespace std;
 
 BEGIN_NAMESPACE_ACADO
 
+
+/** Allocates an array of given length and initializes it with given value. */
+static double* allocateBounds(	uint dim,
+								double defaultBound
+								)
+{
+	double* bounds = (double*) malloc( std::max( dim,1U )*sizeof(double) );
+
+	for( uint i=0; i<dim; ++i )
+		bounds[i] = defaultBound;
+
+	return bounds;
+}
+
+
+/** Returns bounds of nPoints grid points, each consisting of the bounds in 
+ *	first (of dimension dim) followed by those in second (of dimension 
+ *	argDim); missing bounds are replaced by the default bound. Frees first. */
+static double* appendBounds(	double* first,
+								uint dim,
+								const double* second,
+								uint argDim,
+								uint nPoints,
+								double defaultBound
+								)
+{
+	if ( ( first == 0 ) && ( second == 0 ) )
+		return 0;
+
+	double* bounds = allocateBounds( nPoints*(dim+argDim),defaultBound );
+
+	for( uint i=0; i<nPoints; ++i )
+	{
+		if ( first != 0 )
+			memcpy( bounds+i*(dim+argDim),first+i*dim,dim*sizeof(double) );
+
+		if ( second != 0 )
+			memcpy( bounds+i*(dim+argDim)+dim,second+i*argDim,argDim*sizeof(double) );
+	}
+
+	if ( first != 0 )
+		free( first );
+
+	return bounds;
+}
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
 
 MatrixVariablesGrid::MatrixVariablesGrid( ) : Grid( )
 {
-	values = 0;
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
 }
 
 
@@ -63,7 +118,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
 	init( _nRows,_nCols,_grid,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -80,7 +143,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
 	init( _nRows,_nCols,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -99,7 +170,15 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
 	init( _nRows,_nCols,_firstTime,_lastTime,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -109,20 +188,53 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const DMatrix& arg,
 											VariableType _type
 											) : Grid( )
 {
-	values = 0;
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
 	init( arg,_grid,_type );
 }
 
 MatrixVariablesGrid::MatrixVariablesGrid(	const MatrixVariablesGrid& rhs
-											) : Grid( rhs )
+											) : Grid( rhs ), settings( rhs.settings )
 {
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
+	nRows = rhs.nRows;
+	nCols = rhs.nCols;
+	reserveValues( nPoints );
+
+	uint dim = nRows*nCols;
+
+	if ( nPoints*dim > 0 )
+		memcpy( values,rhs.values,nPoints*dim*sizeof(double) );
+
 	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+		memcpy( autoInit,rhs.autoInit,nPoints*sizeof(BooleanType) );
 
-	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( *(rhs.values[i]) );
+	if ( rhs.lowerBounds != 0 )
+	{
+		lowerBounds = allocateBounds( capacity*dim,defaultLowerBound );
+		memcpy( lowerBounds,rhs.lowerBounds,nPoints*dim*sizeof(double) );
+	}
+
+	if ( rhs.upperBounds != 0 )
+	{
+		upperBounds = allocateBounds( capacity*dim,defaultUpperBound );
+		memcpy( upperBounds,rhs.upperBounds,nPoints*dim*sizeof(double) );
+	}
 }
 
 
@@ -141,14 +253,31 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator=(	const MatrixVariablesGrid&
 		clearValues( );
 
 		Grid::operator=( rhs );
+		settings = rhs.settings;
+
+		nRows = rhs.nRows;
+		nCols = rhs.nCols;
+		reserveValues( nPoints );
+
+		uint dim = nRows*nCols;
+
+		if ( nPoints*dim > 0 )
+			memcpy( values,rhs.values,nPoints*dim*sizeof(double) );
 
 		if ( nPoints > 0 )
-			values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-		else
-			values = 0;
-	
-		for( uint i=0; i<nPoints; ++i )
-			values[i] = new MatrixVariable( *(rhs.values[i]) );
+			memcpy( autoInit,rhs.autoInit,nPoints*sizeof(BooleanType) );
+
+		if ( rhs.lowerBounds != 0 )
+		{
+			lowerBounds = allocateBounds( capacity*dim,defaultLowerBound );
+			memcpy( lowerBounds,rhs.lowerBounds,nPoints*dim*sizeof(double) );
+		}
+
+		if ( rhs.upperBounds != 0 )
+		{
+			upperBounds = allocateBounds( capacity*dim,defaultUpperBound );
+			memcpy( upperBounds,rhs.upperBounds,nPoints*dim*sizeof(double) );
+		}
     }
 
     return *this;
@@ -196,11 +325,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -220,11 +344,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _nPoints );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -245,11 +364,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 {
 	clearValues( );
 	Grid::init( _firstTime,_lastTime,_nPoints );
-	
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
 
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
@@ -263,13 +377,17 @@ returnValue MatrixVariablesGrid::init(	const DMatrix& arg,
 	clearValues( );
 	Grid::operator=( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	nRows = arg.getNumRows( );
+	nCols = arg.getNumCols( );
+	reserveValues( nPoints );
+
+	settings.init( arg.getDim( ),_type,0,0 );
 
 	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( arg );
+	{
+		getMatrixMap( i ) = arg;
+		autoInit[i] = defaultAutoInit;
+	}
 
     return SUCCESSFUL_RETURN;
 }
@@ -289,12 +407,13 @@ returnValue MatrixVariablesGrid::setMatrix(	uint pointIdx,
 											const DMatrix& _value
 											) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	*(values[pointIdx]) = _value;
+	if ( ( _value.getNumRows( ) != nRows ) || ( _value.getNumCols( ) != nCols ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	Eigen::Map< Eigen::MatrixXd >( values+pointIdx*nRows*nCols,nRows,nCols ) = _value;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -313,12 +432,10 @@ returnValue MatrixVariablesGrid::setAllMatrices(	const DMatrix& _values
 DMatrix MatrixVariablesGrid::getMatrix(	uint pointIdx
 										) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return emptyMatrix;
 
-	return values[pointIdx]->getMatrix( );
+	return getMatrixMap( pointIdx );
 }
 
 
@@ -341,6 +458,47 @@ DMatrix MatrixVariablesGrid::getLastMatrix( ) const
 
 
 
+Eigen::Map< Eigen::MatrixXd > MatrixVariablesGrid::getMatrixMap(	uint pointIdx
+																	)
+{
+	ASSERT( pointIdx < getNumPoints( ) );
+
+	return Eigen::Map< Eigen::MatrixXd >( values+pointIdx*nRows*nCols,nRows,nCols );
+}
+
+
+Eigen::Map< const Eigen::MatrixXd > MatrixVariablesGrid::getMatrixMap(	uint pointIdx
+																		) const
+{
+	ASSERT( pointIdx < getNumPoints( ) );
+
+	return Eigen::Map< const Eigen::MatrixXd >( values+pointIdx*nRows*nCols,nRows,nCols );
+}
+
+
+Eigen::Map< Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > MatrixVariablesGrid::getComponentMap(	uint rowIdx,
+																											uint colIdx
+																											)
+{
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
+
+	return Eigen::Map< Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> >(	values+colIdx*nRows+rowIdx,getNumPoints( ),
+																				Eigen::InnerStride<>( nRows*nCols ) );
+}
+
+
+Eigen::Map< const Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > MatrixVariablesGrid::getComponentMap(	uint rowIdx,
+																												uint colIdx
+																												) const
+{
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
+
+	return Eigen::Map< const Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> >(	values+colIdx*nRows+rowIdx,getNumPoints( ),
+																						Eigen::InnerStride<>( nRows*nCols ) );
+}
+
+
+
 returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 												MergeMethod _mergeMethod
 												)
@@ -355,7 +513,7 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addMatrix( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -370,13 +528,13 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addMatrix( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addMatrix( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -388,15 +546,37 @@ returnValue MatrixVariablesGrid::appendValues( const MatrixVariablesGrid& arg )
 	if ( getNumPoints( ) != arg.getNumPoints( ) )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-	DVector tmp1,tmp2;
+	if ( getNumPoints( ) == 0 )
+		return SUCCESSFUL_RETURN;
 
-	for( uint i=0; i<getNumPoints(); ++i )
-	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
-	}
+	if ( nCols != arg.nCols )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
 
-	return SUCCESSFUL_RETURN;
+	uint dim    = nRows*nCols;
+	uint argDim = arg.nRows*arg.nCols;
+
+	double* newValues = (double*) malloc( nPoints*(dim+argDim)*sizeof(double) );
+
+	for( uint i=0; i<nPoints; ++i )
+		for( uint j=0; j<nCols; ++j )
+		{
+			memcpy( newValues+i*(dim+argDim)+j*(nRows+arg.nRows),
+					values+i*dim+j*nRows,nRows*sizeof(double) );
+			memcpy( newValues+i*(dim+argDim)+j*(nRows+arg.nRows)+nRows,
+					arg.values+i*argDim+j*arg.nRows,arg.nRows*sizeof(double) );
+		}
+
+	free( values );
+	values = newValues;
+
+	// bounds are stored in the order of the (appended) variable settings
+	lowerBounds = appendBounds( lowerBounds,dim,arg.lowerBounds,argDim,nPoints,defaultLowerBound );
+	upperBounds = appendBounds( upperBounds,dim,arg.upperBounds,argDim,nPoints,defaultUpperBound );
+
+	nRows   += arg.nRows;
+	capacity = nPoints;
+
+	return settings.appendSettings( arg.settings );
 }
 
 
@@ -442,7 +622,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -454,16 +634,16 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addMatrix( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addMatrix( *this,i,getTime( i ) );
+					mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -474,7 +654,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addMatrix( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -483,7 +663,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -509,7 +689,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addMatrix( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -528,7 +708,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getValuesSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+		newVariablesGrid.addMatrix( getMatrix( i ).getRows( startIdx,endIdx ),getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -596,9 +776,9 @@ MatrixVariablesGrid MatrixVariablesGrid::getRefinedGrid(	const Grid& arg,
 			count = acadoMin( count+1,(int)getNumPoints()-1 );
 
 		if ( count < 0 )
-			tmp.addMatrix( *(values[0]),arg.getTime( i ) );
+			tmp.addMatrix( *this,0,arg.getTime( i ) );
 		else
-			tmp.addMatrix( *(values[count]),arg.getTime( i ) );
+			tmp.addMatrix( *this,count,arg.getTime( i ) );
 	}
 
 	return tmp;
@@ -626,7 +806,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getCoarsenedGrid(	const Grid& arg
 		int idx = findLastTime( arg.getTime( i ) );
 
 		if ( idx >= 0 )
-			tmp.addMatrix( *(values[idx]),arg.getTime( i ) );
+			tmp.addMatrix( *this,idx,arg.getTime( i ) );
 		else
 		{
 			tmp.init( );
@@ -651,15 +831,22 @@ MatrixVariablesGrid& MatrixVariablesGrid::shiftBackwards( DMatrix lastValue )
 {
 	if ( getNumPoints() < 2 ){
         if( lastValue.isEmpty() == BT_FALSE )
-             *(values[getNumIntervals()]) = lastValue;	
+             setMatrix( getNumIntervals(),lastValue );
 		return *this;	
     }
 
-	for( uint i=1; i<getNumPoints( ); ++i )
-		*(values[i-1]) = *(values[i]);
+	uint dim = nRows*nCols;
+
+	memmove( values,values+dim,getNumIntervals( )*dim*sizeof(double) );
+	memmove( autoInit,autoInit+1,getNumIntervals( )*sizeof(BooleanType) );
+
+	if ( lowerBounds != 0 )
+		memmove( lowerBounds,lowerBounds+dim,getNumIntervals( )*dim*sizeof(double) );
+	if ( upperBounds != 0 )
+		memmove( upperBounds,upperBounds+dim,getNumIntervals( )*dim*sizeof(double) );
 		
     if( lastValue.isEmpty() == BT_FALSE )
-        *(values[getNumIntervals()]) = lastValue;
+        setMatrix( getNumIntervals(),lastValue );
 
 	return *this;
 }
@@ -668,15 +855,23 @@ MatrixVariablesGrid& MatrixVariablesGrid::shiftBackwards( DMatrix lastValue )
 
 DVector MatrixVariablesGrid::linearInterpolation( double time ) const
 {
-    uint idx1 = getFloorIndex( time );
-    uint idx2 = getCeilIndex ( time );
+	uint hint = 0;
+	return linearInterpolation( time,hint );
+}
+
+
+DVector MatrixVariablesGrid::linearInterpolation( double time, uint& hint ) const
+{
+    uint idx1 = getFloorIndex( time,hint );
+    /* the ceil index is idx1 or idx1+1, search it from there without touching hint */
+    uint ceilHint = idx1;
+    uint idx2 = getCeilIndex ( time,ceilHint );
 
-	ASSERT( values != 0 );
 	ASSERT( idx1 < getNumPoints( ) );
 	ASSERT( idx2 < getNumPoints( ) );
 
-    DVector tmp1( values[idx1]->getCol( 0 ) );
-    DVector tmp2( values[idx2]->getCol( 0 ) );
+    DVector tmp1( getMatrixMap( idx1 ).col( 0 ) );
+    DVector tmp2( getMatrixMap( idx2 ).col( 0 ) );
 
     double t1 = getTime( idx1 );
     double t2 = getTime( idx2 );
@@ -722,7 +917,7 @@ returnValue MatrixVariablesGrid::print(	std::ostream& stream,
 		if (colSeparator != NULL && strlen(colSeparator) > 0)
 			stream << colSeparator;
 
-		values[k]->print(stream, "", "", "", width, precision, colSeparator, colSeparator);
+		getMatrix( k ).print(stream, "", "", "", width, precision, colSeparator, colSeparator);
 
 		if (k < (getNumPoints() - 1) && rowSeparator != NULL && strlen(rowSeparator) > 0)
 			stream << rowSeparator;
@@ -894,16 +1089,50 @@ std::istream& operator>>(std::istream& stream, MatrixVariablesGrid& arg)
 returnValue MatrixVariablesGrid::clearValues( )
 {
 	if ( values != 0 )
-	{
-		for( uint i=0; i<nPoints; ++i )
-		{
-			if ( values[i] != 0 )
-				delete values[i];
-		}
-
 		free( values );
-		values = 0;
-	}
+
+	if ( lowerBounds != 0 )
+		free( lowerBounds );
+
+	if ( upperBounds != 0 )
+		free( upperBounds );
+
+	if ( autoInit != 0 )
+		free( autoInit );
+
+	nRows    = 0;
+	nCols    = 0;
+	capacity = 0;
+
+	values      = 0;
+	lowerBounds = 0;
+	upperBounds = 0;
+	autoInit    = 0;
+
+	settings.init( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::reserveValues(	uint _capacity
+												)
+{
+	if ( _capacity <= capacity )
+		return SUCCESSFUL_RETURN;
+
+	uint dim = nRows*nCols;
+
+	values   = (double*) realloc( values,std::max( _capacity*dim,1U )*sizeof(double) );
+	autoInit = (BooleanType*) realloc( autoInit,_capacity*sizeof(BooleanType) );
+
+	if ( lowerBounds != 0 )
+		lowerBounds = (double*) realloc( lowerBounds,std::max( _capacity*dim,1U )*sizeof(double) );
+
+	if ( upperBounds != 0 )
+		upperBounds = (double*) realloc( upperBounds,std::max( _capacity*dim,1U )*sizeof(double) );
+
+	capacity = _capacity;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -920,26 +1149,30 @@ returnValue MatrixVariablesGrid::initMatrixVariables(	uint _nRows,
 														const BooleanType* const _autoInit
 														)
 {
-	DVector currentScaling,currentLb,currentUb;
+	nRows = _nRows;
+	nCols = _nCols;
+	reserveValues( nPoints );
+
+	uint dim = nRows*nCols;
+
+	for( uint i=0; i<nPoints*dim; ++i )
+		values[i] = 0.0;
 
 	for( uint i=0; i<nPoints; ++i )
-	{
-		if ( _scaling != 0 )
-			currentScaling = _scaling[i];
-		else
-			currentScaling.init( );
+		autoInit[i] = defaultAutoInit;
 
-		if ( _lb != 0 )
-			currentLb = _lb[i];
-		else
-			currentLb.init( );
+	if ( ( _scaling != 0 ) && ( nPoints > 0 ) )
+		settings.init( dim,_type,_names,_units,_scaling[0] );
+	else
+		settings.init( dim,_type,_names,_units );
 
-		if ( _ub != 0 )
-			currentUb = _ub[i];
-		else
-			currentUb.init( );
+	for( uint i=0; i<nPoints; ++i )
+	{
+		if ( ( _lb != 0 ) && ( _lb[i].isEmpty( ) == BT_FALSE ) )
+			ACADO_TRY( setLowerBounds( i,_lb[i] ) );
 
-		values[i] = new MatrixVariable( _nRows,_nCols,_type,_names,_units,currentScaling,currentLb,currentUb );
+		if ( ( _ub != 0 ) && ( _ub[i].isEmpty( ) == BT_FALSE ) )
+			ACADO_TRY( setUpperBounds( i,_ub[i] ) );
 	}
 	
 	return SUCCESSFUL_RETURN;
@@ -953,11 +1186,76 @@ returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariable& newMatrix,
 	if ( ( isInfty( newTime ) == BT_TRUE ) && ( getNumPoints( ) > 0 ) )
 		newTime = getLastTime( ) + 1.0;
 
+	if ( ( getNumPoints( ) > 0 ) &&
+		 ( ( newMatrix.getNumRows( ) != nRows ) || ( newMatrix.getNumCols( ) != nCols ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
 	if ( Grid::addTime( newTime ) != SUCCESSFUL_RETURN )
 		return RET_INVALID_ARGUMENTS;
 
-	values = (MatrixVariable**) realloc( values,nPoints*sizeof(MatrixVariable*) );
-	values[nPoints-1] = new MatrixVariable( newMatrix );
+	// first grid point determines dimensions and settings of all grid points
+	if ( getNumPoints( ) == 1 )
+	{
+		clearValues( );
+
+		nRows = newMatrix.getNumRows( );
+		nCols = newMatrix.getNumCols( );
+		settings = newMatrix;
+	}
+
+	if ( getNumPoints( ) > capacity )
+		reserveValues( std::max( 2*capacity,getNumPoints( ) ) );
+
+	getMatrixMap( getLastIndex( ) ) = newMatrix;
+	autoInit[getLastIndex( )] = newMatrix.getAutoInit( );
+
+	if ( ( newMatrix.hasLowerBounds( ) == BT_TRUE ) || ( lowerBounds != 0 ) )
+		setLowerBounds( getLastIndex( ),newMatrix.getLowerBounds( ) );
+
+	if ( ( newMatrix.hasUpperBounds( ) == BT_TRUE ) || ( upperBounds != 0 ) )
+		setUpperBounds( getLastIndex( ),newMatrix.getUpperBounds( ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariablesGrid& arg,
+											uint argIdx,
+											double newTime
+											)
+{
+	if ( argIdx >= arg.getNumPoints( ) )
+		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+	if ( ( getNumPoints( ) > 0 ) && ( ( arg.nRows != nRows ) || ( arg.nCols != nCols ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( Grid::addTime( newTime ) != SUCCESSFUL_RETURN )
+		return RET_INVALID_ARGUMENTS;
+
+	// first grid point determines dimensions and settings of all grid points
+	if ( getNumPoints( ) == 1 )
+	{
+		clearValues( );
+
+		nRows = arg.nRows;
+		nCols = arg.nCols;
+		settings = arg.settings;
+	}
+
+	if ( getNumPoints( ) > capacity )
+		reserveValues( std::max( 2*capacity,getNumPoints( ) ) );
+
+	uint dim = nRows*nCols;
+
+	memcpy( values+getLastIndex( )*dim,arg.values+argIdx*dim,dim*sizeof(double) );
+	autoInit[getLastIndex( )] = arg.autoInit[argIdx];
+
+	if ( ( arg.lowerBounds != 0 ) || ( lowerBounds != 0 ) )
+		setLowerBounds( getLastIndex( ),arg.getLowerBounds( argIdx ) );
+
+	if ( ( arg.upperBounds != 0 ) || ( upperBounds != 0 ) )
+		setUpperBounds( getLastIndex( ),arg.getUpperBounds( argIdx ) );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -982,12 +1280,12 @@ returnValue MatrixVariablesGrid::sprint(	std::ostream& stream
 		}
 	}
 
-	unsigned nRows = getNumPoints();
-	unsigned nCols = getNumValues() + 1;
-	for (run1 = 0; run1 < nRows; run1++) {
-		for (run2 = 0; run2 < nCols; run2++) {
-			if (tmp[nCols * run1 + run2] <= ACADO_NAN - 1.0)
-				stream << scientific << tmp[nCols * run1 + run2] << TEXT_SEPARATOR;
+	unsigned nPrintRows = getNumPoints();
+	unsigned nPrintCols = getNumValues() + 1;
+	for (run1 = 0; run1 < nPrintRows; run1++) {
+		for (run2 = 0; run2 < nPrintCols; run2++) {
+			if (tmp[nPrintCols * run1 + run2] <= ACADO_NAN - 1.0)
+				stream << scientific << tmp[nPrintCols * run1 + run2] << TEXT_SEPARATOR;
 			else
 				stream << NOT_A_NUMBER << TEXT_SEPARATOR;
 		}
@@ -1011,19 +1309,19 @@ returnValue MatrixVariablesGrid::sprint(	std::ostream& stream
 
 double& MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx )
 {
-	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+    return values[pointIdx*nRows*nCols + colIdx*nRows + rowIdx];
 }
 
 
 double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx ) const
 {
-	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < nRows ) && ( colIdx < nCols ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+    return values[pointIdx*nRows*nCols + colIdx*nRows + rowIdx];
 }
 
 
@@ -1031,7 +1329,6 @@ double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx
 MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 															) const
 {
-    ASSERT( values != 0 );
 	if ( rowIdx >= getNumRows( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -1044,7 +1341,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 	MatrixVariablesGrid rowGrid( 1,1,tmpGrid,getType( ) );
 
     for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0,0 ) = values[run1]->operator()( rowIdx,0 );
+         rowGrid( run1,0,0 ) = operator()( run1,rowIdx,0 );
 
     return rowGrid;
 }
@@ -1053,7 +1350,6 @@ MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 															) const
 {
-    ASSERT( values != 0 );
 	if ( pointIdx >= getNumPoints( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -1061,7 +1357,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 	}
 
 	MatrixVariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addMatrix( *this,pointIdx,getTime( pointIdx ) );
 
     return pointGrid;
 }
@@ -1075,10 +1371,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator+(	const MatrixVariablesGrid& a
 
 	MatrixVariablesGrid tmp( *this );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) += *(arg.values[i]);
-
-	return tmp;
+	return ( tmp += arg );
 }
 
 
@@ -1090,8 +1383,10 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator+=(	const MatrixVariablesGrid&
 {
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) += *(arg.values[i]);
+	ASSERT( ( nRows == arg.nRows ) && ( nCols == arg.nCols ) );
+
+	for( uint i=0; i<getDim( ); ++i )
+		values[i] += arg.values[i];
 
 	return *this;
 }
@@ -1105,10 +1400,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator-(	const MatrixVariablesGrid& a
 
 	MatrixVariablesGrid tmp( *this );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) -= *(arg.values[i]);
-
-	return tmp;
+	return ( tmp -= arg );
 }
 
 
@@ -1117,8 +1409,10 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator-=(	const MatrixVariablesGrid&
 {
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) -= *(arg.values[i]);
+	ASSERT( ( nRows == arg.nRows ) && ( nCols == arg.nCols ) );
+
+	for( uint i=0; i<getDim( ); ++i )
+		values[i] -= arg.values[i];
 
 	return *this;
 }
@@ -1127,76 +1421,71 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator-=(	const MatrixVariablesGrid&
 
 uint MatrixVariablesGrid::getDim( ) const
 {
-	uint totalDim = 0;
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		totalDim += values[i]->getDim( );
-
-	return totalDim;
+	return getNumPoints( )*nRows*nCols;
 }
 
 
 
 uint MatrixVariablesGrid::getNumRows( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumRows( 0 );
+	return nRows;
 }
 
 
 uint MatrixVariablesGrid::getNumCols( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumCols( 0 );
+	return nCols;
 }
 
 
 uint MatrixVariablesGrid::getNumValues( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
-	return getNumValues( 0 );
+	return nRows*nCols;
 }
 
 
 uint MatrixVariablesGrid::getNumRows(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumRows( );
+    return nRows;
 }
 
 
 uint MatrixVariablesGrid::getNumCols(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumCols( );
+    return nCols;
 }
 
 
 uint MatrixVariablesGrid::getNumValues(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getDim( );
+    return nRows*nCols;
 }
 
 
@@ -1213,10 +1502,7 @@ VariableType MatrixVariablesGrid::getType( ) const
 returnValue MatrixVariablesGrid::setType(	VariableType _type
 													)
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-		setType( i,_type );
-
-	return SUCCESSFUL_RETURN;
+	return settings.setType( _type );
 }
 
 
@@ -1226,7 +1512,7 @@ VariableType MatrixVariablesGrid::getType(	uint pointIdx
 	if ( pointIdx >= getNumPoints( ) )
 		return VT_UNKNOWN;
 
-	return values[pointIdx]->getType( );
+	return settings.getType( );
 }
 
 
@@ -1237,7 +1523,7 @@ returnValue MatrixVariablesGrid::setType(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setType( _type );
+	return settings.setType( _type );
 }
 
 
@@ -1250,7 +1536,7 @@ returnValue MatrixVariablesGrid::getName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getName( idx,_name );
+	return settings.getName( idx,_name );
 }
 
 
@@ -1262,7 +1548,7 @@ returnValue MatrixVariablesGrid::setName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setName( idx,_name );
+	return settings.setName( idx,_name );
 }
 
 
@@ -1275,7 +1561,7 @@ returnValue MatrixVariablesGrid::getUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getUnit( idx,_unit );
+	return settings.getUnit( idx,_unit );
 }
 
 
@@ -1287,7 +1573,7 @@ returnValue MatrixVariablesGrid::setUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setUnit( idx,_unit );
+	return settings.setUnit( idx,_unit );
 }
 
 
@@ -1298,7 +1584,7 @@ DVector MatrixVariablesGrid::getScaling(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getScaling( );
+	return settings.getScaling( );
 }
 
 
@@ -1309,7 +1595,7 @@ returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
     if ( pointIdx >= getNumPoints( ) )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setScaling( _scaling );
+    return settings.setScaling( _scaling );
 }
 
 
@@ -1320,7 +1606,7 @@ double MatrixVariablesGrid::getScaling(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return -1.0;
 
-	return values[pointIdx]->getScaling( valueIdx );
+	return settings.getScaling( valueIdx );
 }
 
 
@@ -1332,11 +1618,10 @@ returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setScaling( valueIdx,_scaling );
-    return SUCCESSFUL_RETURN;
+    return settings.setScaling( valueIdx,_scaling );
 }
 
 
@@ -1347,7 +1632,17 @@ DVector MatrixVariablesGrid::getLowerBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getLowerBounds( );
+	DVector tmp( getNumValues( ) );
+
+	if ( lowerBounds != 0 )
+	{
+		for( uint i=0; i<getNumValues( ); ++i )
+			tmp( i ) = lowerBounds[pointIdx*getNumValues( )+i];
+	}
+	else
+		tmp.setAll( defaultLowerBound );
+
+	return tmp;
 }
 
 
@@ -1358,7 +1653,16 @@ returnValue MatrixVariablesGrid::setLowerBounds(	uint pointIdx,
     if( pointIdx >= nPoints )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setLowerBounds( _lb );
+	if( _lb.getDim( ) != getNumValues( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( lowerBounds == 0 )
+		lowerBounds = allocateBounds( capacity*getNumValues( ),defaultLowerBound );
+
+	for( uint i=0; i<getNumValues( ); ++i )
+		lowerBounds[pointIdx*getNumValues( )+i] = _lb( i );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -1369,7 +1673,13 @@ double MatrixVariablesGrid::getLowerBound(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return -INFTY;
 
-	return values[pointIdx]->getLowerBound( valueIdx );
+	if ( valueIdx >= getNumValues( ) )
+		return INFTY;
+
+	if ( lowerBounds == 0 )
+		return defaultLowerBound;
+
+	return lowerBounds[pointIdx*getNumValues( )+valueIdx];
 }
 
 
@@ -1381,10 +1691,13 @@ returnValue MatrixVariablesGrid::setLowerBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	values[pointIdx]->setLowerBound( valueIdx,_lb );
+	if ( lowerBounds == 0 )
+		lowerBounds = allocateBounds( capacity*getNumValues( ),defaultLowerBound );
+
+	lowerBounds[pointIdx*getNumValues( )+valueIdx] = _lb;
     return SUCCESSFUL_RETURN;
 }
 
@@ -1396,7 +1709,17 @@ DVector MatrixVariablesGrid::getUpperBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getUpperBounds( );
+	DVector tmp( getNumValues( ) );
+
+	if ( upperBounds != 0 )
+	{
+		for( uint i=0; i<getNumValues( ); ++i )
+			tmp( i ) = upperBounds[pointIdx*getNumValues( )+i];
+	}
+	else
+		tmp.setAll( defaultUpperBound );
+
+	return tmp;
 }
 
 
@@ -1407,7 +1730,16 @@ returnValue MatrixVariablesGrid::setUpperBounds(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setUpperBounds( _ub );
+	if( _ub.getDim( ) != getNumValues( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( upperBounds == 0 )
+		upperBounds = allocateBounds( capacity*getNumValues( ),defaultUpperBound );
+
+	for( uint i=0; i<getNumValues( ); ++i )
+		upperBounds[pointIdx*getNumValues( )+i] = _ub( i );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -1418,7 +1750,13 @@ double MatrixVariablesGrid::getUpperBound(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return INFTY;
 
-	return values[pointIdx]->getUpperBound( valueIdx );
+	if ( valueIdx >= getNumValues( ) )
+		return -INFTY;
+
+	if ( upperBounds == 0 )
+		return defaultUpperBound;
+
+	return upperBounds[pointIdx*getNumValues( )+valueIdx];
 }
 
 
@@ -1430,10 +1768,13 @@ returnValue MatrixVariablesGrid::setUpperBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setUpperBound( valueIdx,_ub );
+	if ( upperBounds == 0 )
+		upperBounds = allocateBounds( capacity*getNumValues( ),defaultUpperBound );
+
+	upperBounds[pointIdx*getNumValues( )+valueIdx] = _ub;
     return SUCCESSFUL_RETURN;
 }
 
@@ -1448,7 +1789,7 @@ BooleanType MatrixVariablesGrid::getAutoInit(	uint pointIdx
 		return defaultAutoInit;
 	}
 
-	return values[pointIdx]->getAutoInit( );
+	return autoInit[pointIdx];
 }
 
 
@@ -1459,14 +1800,16 @@ returnValue MatrixVariablesGrid::setAutoInit(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setAutoInit( _autoInit );
+	autoInit[pointIdx] = _autoInit;
+
+	return SUCCESSFUL_RETURN;
 }
 
 
 returnValue MatrixVariablesGrid::disableAutoInit( )
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_FALSE );
+		autoInit[i] = BT_FALSE;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1475,7 +1818,7 @@ returnValue MatrixVariablesGrid::disableAutoInit( )
 returnValue MatrixVariablesGrid::enableAutoInit( )
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_TRUE );
+		autoInit[i] = BT_TRUE;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1484,61 +1827,46 @@ returnValue MatrixVariablesGrid::enableAutoInit( )
 
 BooleanType MatrixVariablesGrid::hasNames( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasNames( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return settings.hasNames( );
 }
 
 
 BooleanType MatrixVariablesGrid::hasUnits( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasUnits( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return settings.hasUnits( );
 }
 
 
 BooleanType MatrixVariablesGrid::hasScaling( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasScaling( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( getNumPoints( ) == 0 )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return settings.hasScaling( );
 }
 
 
 BooleanType MatrixVariablesGrid::hasLowerBounds( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasLowerBounds( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( ( getNumPoints( ) == 0 ) || ( lowerBounds == 0 ) )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return BT_TRUE;
 }
 
 
 BooleanType MatrixVariablesGrid::hasUpperBounds( ) const
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( values[i]->hasUpperBounds( ) == BT_TRUE )
-			return BT_TRUE;
-	}
+	if ( ( getNumPoints( ) == 0 ) || ( upperBounds == 0 ) )
+		return BT_FALSE;
 
-	return BT_FALSE;
+	return BT_TRUE;
 }
 
 
@@ -1549,8 +1877,8 @@ double MatrixVariablesGrid::getMax( ) const
 
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->getMax( ) > maxValue )
-			maxValue = values[i]->getMax( );
+		if ( getMatrixMap( i ).maxCoeff( ) > maxValue )
+			maxValue = getMatrixMap( i ).maxCoeff( );
 	}
 
 	return maxValue;
@@ -1563,8 +1891,8 @@ double MatrixVariablesGrid::getMin( ) const
 
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->getMin( ) < minValue )
-			minValue = values[i]->getMin( );
+		if ( getMatrixMap( i ).minCoeff( ) < minValue )
+			minValue = getMatrixMap( i ).minCoeff( );
 	}
 
 	return minValue;
@@ -1579,7 +1907,7 @@ double MatrixVariablesGrid::getMean( ) const
 		return meanValue;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		meanValue += values[i]->getMean( );
+		meanValue += getMatrixMap( i ).mean( );
 
 	return ( meanValue / (double)getNumPoints( ) );
 }
@@ -1588,8 +1916,8 @@ double MatrixVariablesGrid::getMean( ) const
 
 returnValue MatrixVariablesGrid::setZero( )
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setZero( );
+	for( uint i=0; i<getDim( ); ++i )
+		values[i] = 0.0;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1598,8 +1926,8 @@ returnValue MatrixVariablesGrid::setZero( )
 returnValue MatrixVariablesGrid::setAll(	double _value
 												)
 {
-    for( uint i = 0; i<getNumPoints( ); ++i )
-		values[i]->setAll( _value );
+    for( uint i = 0; i<getDim( ); ++i )
+		values[i] = _value;
 
     return SUCCESSFUL_RETURN;
 }
@@ -34,6 +34,7 @@
 #define ACADO_TOOLKIT_MATRIX_VARIABLES_GRID_HPP
 
 #include <acado/variables_grid/grid.hpp>
+#include <acado/variables_grid/variable_settings.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -52,8 +53,14 @@ class MatrixVariable;
  *	matrix-valued optimization variables at each grid point, as they 
  *	usually occur when discretizing optimal control problems.
  *
- *	The class inherits from the Grid class and stores the matrix-valued
- *	optimization variables in an re-allocatable array of MatrixVariables.
+ *	The class inherits from the Grid class and stores the numerical values of 
+ *	the matrix-valued optimization variables contiguously in a single 
+ *	time x rows x cols array (each matrix in column-major order), which 
+ *	grows geometrically when grid points are added. Type, names, units and 
+ *	scaling are shared by all grid points, whereas bounds and auto-initialization 
+ *	flags are kept for each grid point. Matrices at single grid points as well 
+ *	as the values of single components at all grid points can be accessed 
+ *	without copying via Eigen maps.
  *
  *	\author Hans Joachim Ferreau, Boris Houska, Milan Vukov
  */
@@ -408,7 +415,8 @@ class MatrixVariablesGrid : public Grid
 		 *	@param[in] newTime		Time of grid point to be added.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_INVALID_ARGUMENTS
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
 		 */
 		returnValue addMatrix(	const DMatrix& newMatrix,
 								double newTime = -INFTY
@@ -420,7 +428,8 @@ class MatrixVariablesGrid : public Grid
 		 *	@param[in] _value		New matrix.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 *	        RET_INDEX_OUT_OF_BOUNDS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
 		 */
 		returnValue setMatrix(	uint pointIdx,
 								const DMatrix& _value
@@ -459,6 +468,55 @@ class MatrixVariablesGrid : public Grid
 		DMatrix getLastMatrix( ) const;
 
 
+		/** Returns a map to the matrix at grid point with given index.
+		 *	The map refers to the internal storage of the grid and is 
+		 *	invalidated as soon as grid points are added or removed.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return Map to the matrix at grid point with given index
+		 */
+		Eigen::Map< Eigen::MatrixXd > getMatrixMap(	uint pointIdx
+													);
+
+		/** Returns a (read-only) map to the matrix at grid point with given index.
+		 *	The map refers to the internal storage of the grid and is 
+		 *	invalidated as soon as grid points are added or removed.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return Map to the matrix at grid point with given index
+		 */
+		Eigen::Map< const Eigen::MatrixXd > getMatrixMap(	uint pointIdx
+															) const;
+
+		/** Returns a map to the values of one matrix component at all grid 
+		 *	points. The map refers to the internal storage of the grid and is 
+		 *	invalidated as soon as grid points are added or removed.
+		 *
+		 *	@param[in] rowIdx		Row index of the component.
+		 *	@param[in] colIdx		Column index of the component.
+		 *
+		 *  \return Map to the values of the component at all grid points
+		 */
+		Eigen::Map< Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > getComponentMap(	uint rowIdx,
+																								uint colIdx = 0
+																								);
+
+		/** Returns a (read-only) map to the values of one matrix component at all 
+		 *	grid points. The map refers to the internal storage of the grid and is 
+		 *	invalidated as soon as grid points are added or removed.
+		 *
+		 *	@param[in] rowIdx		Row index of the component.
+		 *	@param[in] colIdx		Column index of the component.
+		 *
+		 *  \return Map to the values of the component at all grid points
+		 */
+		Eigen::Map< const Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > getComponentMap(	uint rowIdx,
+																									uint colIdx = 0
+																									) const;
+
+
 		/** Returns total dimension of MatrixVariablesGrid, i.e. the sum
 		 *	of dimensions of matrices at all grid point.
 		 *
@@ -1044,6 +1102,20 @@ class MatrixVariablesGrid : public Grid
 		DVector linearInterpolation(	double time
 									) const;
 
+		/** Returns a vector with interpolated values of the MatrixVariablesGrid 
+		 *	at given time, see above. The grid points are searched for starting at 
+		 *	the index of a previous lookup, which makes sequential interpolation at 
+		 *	increasing times cost amortized O(1) (see Grid::getFloorIndex).
+		 *
+		 *	@param[in]     time		Time for evaluation.
+		 *	@param[in,out] hint		Index of a previous lookup (or 0), updated on return.
+		 *
+		 *  \return DVector with interpolated values at given time
+		 */
+		DVector linearInterpolation(	double time,
+										uint& hint
+										) const;
+
 		/** Prints object to standard ouput stream. Various settings can
 		 *	be specified defining its output format. 
 		 *
@@ -1186,6 +1258,15 @@ class MatrixVariablesGrid : public Grid
 		 */
 		returnValue clearValues( );
 
+		/** Ensures that memory for at least the given number of grid points 
+		 *	is allocated.
+		 *
+		 *	@param[in] _capacity	Number of grid points.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue reserveValues(	uint _capacity
+									);
 
 		/** Initializes array of MatrixVariables with given information.
 		 *	Note that this function assumes that the grid has already been setup.
@@ -1219,19 +1300,44 @@ class MatrixVariablesGrid : public Grid
 		 *	@param[in] newTime		Time of grid point to be added.
 		 *
 		 *  \return SUCCESSFUL_RETURN, \n
-		 *	        RET_INVALID_ARGUMENTS
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
 		 */
 		returnValue addMatrix(	const MatrixVariable& newMatrix,
 								double newTime = -INFTY
 								);
 
+		/** Adds a new grid point at given time to grid, comprising the matrix
+		 *	(and its settings) at grid point with given index of another grid.
+		 *
+		 *	@param[in] arg			Grid containing the matrix to be added.
+		 *	@param[in] argIdx		Index of grid point of arg.
+		 *	@param[in] newTime		Time of grid point to be added.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue addMatrix(	const MatrixVariablesGrid& arg,
+								uint argIdx,
+								double newTime
+								);
+
     //
     // DATA MEMBERS:
     //
     protected:
 
-		/** DMatrix-valued optimization variable at all grid points. */
-		MatrixVariable** values;
+		uint nRows;						/**< Number of rows of the matrices at all grid points. */
+		uint nCols;						/**< Number of columns of the matrices at all grid points. */
+		uint capacity;					/**< Number of grid points for which memory is allocated. */
+
+		double* values;					/**< Values of the matrices at all grid points (time x rows x cols, each matrix column-major). */
+		double* lowerBounds;			/**< Lower bounds at all grid points, dim = rows*cols entries per grid point (0 if no bounds are set). */
+		double* upperBounds;			/**< Upper bounds at all grid points, dim = rows*cols entries per grid point (0 if no bounds are set). */
+		BooleanType* autoInit;			/**< Flags indicating whether variable is to be automatically initialized, for all grid points. */
+
+		VariableSettings settings;		/**< Type, names, units and scaling shared by all grid points. */
 };
 
 CLOSE_NAMESPACE_ACADO
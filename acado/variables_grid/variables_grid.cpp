@@ -32,6 +32,7 @@
 
 
 #include <acado/variables_grid/variables_grid.hpp>
+#include <acado/variables_grid/variables_grid_view.hpp>
 #include <acado/variables_grid/matrix_variable.hpp>
 
 
@@ -129,6 +130,13 @@ VariablesGrid::VariablesGrid(	const MatrixVariablesGrid& rhs
 }
 
 
+VariablesGrid::VariablesGrid(	const VariablesGridView& rhs
+								) : MatrixVariablesGrid( )
+{
+	operator=( rhs );
+}
+
+
 
 VariablesGrid::~VariablesGrid( )
 {
@@ -159,6 +167,45 @@ VariablesGrid& VariablesGrid::operator=( const MatrixVariablesGrid& rhs )
 }
 
 
+VariablesGrid& VariablesGrid::operator=( const VariablesGridView& rhs )
+{
+	uint i,j;
+
+	if ( rhs.grid == this )
+	{
+		VariablesGrid tmp( rhs );
+		return operator=( tmp );
+	}
+
+	// overwrite existing grid points if dimensions match
+	if ( ( getNumPoints( ) == rhs.getNumPoints( ) ) && ( getNumPoints( ) > 0 ) &&
+		 ( getNumRows( ) == rhs.getNumValues( ) ) && ( getNumCols( ) == 1 ) )
+	{
+		for( i=0; i<getNumPoints( ); ++i )
+		{
+			setTime( i,rhs.getTime( i ) );
+
+			for( j=0; j<rhs.getNumValues( ); ++j )
+				operator()( i,j ) = rhs( i,j );
+		}
+
+		return *this;
+	}
+
+	init( );
+
+	for( i=0; i<rhs.getNumPoints( ); ++i )
+	{
+		if ( rhs.grid->getNumRows( ) == rhs.getNumValues( ) )
+			addMatrix( *(rhs.grid),rhs.getGridIndex( i ),rhs.getTime( i ) );
+		else
+			addVector( rhs.getVector( i ),rhs.getTime( i ) );
+	}
+
+	return *this;
+}
+
+
 VariablesGrid& VariablesGrid::operator=( const DMatrix& rhs )
 {
 	MatrixVariablesGrid::operator=( rhs );
@@ -169,7 +216,6 @@ VariablesGrid& VariablesGrid::operator=( const DMatrix& rhs )
 VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 											) const
 {
-    ASSERT( values != 0 );
 	if ( rowIdx >= getNumRows( ) )
 	{
 		ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
@@ -182,7 +228,7 @@ VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 	VariablesGrid rowGrid( 1,tmpGrid,getType( ) );
 
     for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0 ) = values[run1]->operator()( rowIdx,0 );
+         rowGrid( run1,0 ) = operator()( run1,rowIdx );
 
     return rowGrid;
 }
@@ -191,7 +237,6 @@ VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 VariablesGrid VariablesGrid::operator[](	const uint pointIdx
 												) const
 {
-    ASSERT( values != 0 );
 	if ( pointIdx >= getNumPoints( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -199,7 +244,7 @@ VariablesGrid VariablesGrid::operator[](	const uint pointIdx
 	}
 
 	VariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addMatrix( *this,pointIdx,getTime( pointIdx ) );
 
     return pointGrid;
 }
@@ -306,10 +351,10 @@ returnValue VariablesGrid::setAllVectors(	const DVector& _values
 DVector VariablesGrid::getVector(	uint pointIdx
 									) const
 {
-	if ( ( values == 0 ) || ( pointIdx >= getNumPoints() ) )
+	if ( pointIdx >= getNumPoints() )
 		return emptyVector;
 
-	return values[pointIdx]->getCol( 0 );
+	return getMatrixMap( pointIdx ).col( 0 );
 }
 
 
@@ -381,7 +426,7 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addMatrix( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -396,13 +441,13 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addMatrix( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addMatrix( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -427,18 +472,7 @@ returnValue VariablesGrid::appendValues( const VariablesGrid& arg )
 		return SUCCESSFUL_RETURN;
 	}
 
-	if ( getNumPoints( ) != arg.getNumPoints( ) )
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
-
-	DVector tmp1,tmp2;
-
-	for( uint i=0; i<getNumPoints(); ++i )
-	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
-	}
-
-	return SUCCESSFUL_RETURN;
+	return MatrixVariablesGrid::appendValues( arg );
 }
 
 
@@ -484,7 +518,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -496,16 +530,16 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addMatrix( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addMatrix( *this,i,getTime( i ) );
+					mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -516,7 +550,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addMatrix( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -525,7 +559,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addMatrix( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -552,7 +586,7 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addMatrix( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -578,13 +612,13 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	double startTime,
 	
 	// add all matrices in interval (constant interpolation)
 	if ( ( hasTime( startTime ) == BT_FALSE ) && ( startIdx > 0 ) )
-		newVariablesGrid.addMatrix( *(values[ startIdx-1 ]),startTime );
+		newVariablesGrid.addMatrix( *this,startIdx-1,startTime );
 	
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addMatrix( *this,i,getTime( i ) );
 	
 	if ( hasTime( endTime ) == BT_FALSE )
-		newVariablesGrid.addMatrix( *(values[ endIdx ]),endTime );
+		newVariablesGrid.addMatrix( *this,endIdx,endTime );
 
     return newVariablesGrid;
 }
@@ -603,7 +637,7 @@ VariablesGrid VariablesGrid::getValuesSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+		newVariablesGrid.addMatrix( getMatrix( i ).getRows( startIdx,endIdx ),getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -38,6 +38,8 @@
 
 BEGIN_NAMESPACE_ACADO
 
+class VariablesGridView;
+
 
 /**
  *	\brief Provides a time grid consisting of vector-valued optimization variables at each grid point.
@@ -194,6 +196,13 @@ class VariablesGrid : public MatrixVariablesGrid
         VariablesGrid(	const MatrixVariablesGrid& rhs
 						);
 
+		/** Constructor which copies the grid points viewed by a VariablesGridView.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+        VariablesGrid(	const VariablesGridView& rhs
+						);
+
 
         /** Destructor.
 		 */
@@ -214,6 +223,16 @@ class VariablesGrid : public MatrixVariablesGrid
         VariablesGrid& operator=(	const MatrixVariablesGrid& rhs
 									);
 
+        /** Assignment operator which copies the grid points viewed by a 
+		 *	VariablesGridView. If the object already has the same number of 
+		 *	grid points and components as the view, only times and values 
+		 *	are overwritten and no memory is allocated.
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+        VariablesGrid& operator=(	const VariablesGridView& rhs
+									);
+
         operator DMatrix() const;
 
 		/** Assignment operator which reads data from a matrix. The data is interpreted 
@@ -0,0 +1,236 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/variables_grid/variables_grid_view.cpp
+ */
+
+
+#include <acado/variables_grid/variables_grid_view.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+VariablesGridView::VariablesGridView( )
+{
+	grid = 0;
+
+	nPoints    = 0;
+	firstPoint = 0;
+	lastPoint  = 0;
+	firstTime  = 0.0;
+	lastTime   = 0.0;
+
+	firstValue = 0;
+	nValues    = 0;
+}
+
+
+VariablesGridView::VariablesGridView(	const VariablesGrid& _grid
+										)
+{
+	init( _grid );
+}
+
+
+VariablesGridView::VariablesGridView(	const VariablesGrid& _grid,
+										double startTime,
+										double endTime,
+										BooleanType extrapolate
+										)
+{
+	grid = 0;
+	init( _grid,startTime,endTime,extrapolate );
+}
+
+
+VariablesGridView::~VariablesGridView( )
+{
+}
+
+
+
+returnValue VariablesGridView::init(	const VariablesGrid& _grid
+										)
+{
+	grid = &_grid;
+
+	nPoints    = _grid.getNumPoints( );
+	firstPoint = 0;
+	lastPoint  = 0;
+	firstTime  = 0.0;
+	lastTime   = 0.0;
+
+	if ( nPoints > 0 )
+	{
+		lastPoint = nPoints-1;
+		firstTime = _grid.getFirstTime( );
+		lastTime  = _grid.getLastTime( );
+	}
+
+	firstValue = 0;
+	nValues    = _grid.getNumValues( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue VariablesGridView::init(	const VariablesGrid& _grid,
+										double startTime,
+										double endTime,
+										BooleanType extrapolate
+										)
+{
+	// grid points of previous window on same grid serve as starting points for the search
+	uint startHint = 0;
+	uint endHint   = 0;
+
+	if ( grid == &_grid )
+	{
+		startHint = firstPoint;
+		endHint   = lastPoint;
+	}
+
+	init( _grid );
+	nPoints = 0;
+
+	if ( _grid.getNumPoints( ) == 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	// constant extrapolation beyond end of grid
+	if ( ( extrapolate == BT_TRUE ) && ( acadoIsSmaller( endTime,_grid.getLastTime( ) ) == BT_FALSE ) )
+	{
+		if ( acadoIsSmaller( _grid.getLastTime( ),startTime ) == BT_TRUE )
+		{
+			nPoints    = 2;
+			firstPoint = _grid.getLastIndex( );
+			lastPoint  = _grid.getLastIndex( );
+			firstTime  = startTime;
+			lastTime   = endTime;
+
+			return SUCCESSFUL_RETURN;
+		}
+
+		if ( init( _grid,startTime,_grid.getLastTime( ) ) != SUCCESSFUL_RETURN )
+			return RET_INVALID_ARGUMENTS;
+
+		lastTime = endTime;
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( ( _grid.isInInterval( startTime ) == BT_FALSE ) || ( _grid.isInInterval( endTime ) == BT_FALSE ) )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	uint startIdx = _grid.getCeilIndex( startTime,startHint );
+	uint endIdx   = _grid.getFloorIndex( endTime,endHint );
+
+	// same grid points as VariablesGrid::getTimeSubGrid (constant interpolation)
+	if ( ( _grid.hasTime( startTime,startHint ) == BT_FALSE ) && ( startIdx > 0 ) )
+	{
+		firstPoint = startIdx-1;
+		firstTime  = startTime;
+		++nPoints;
+	}
+	else
+	{
+		firstPoint = startIdx;
+		firstTime  = _grid.getTime( startIdx );
+	}
+
+	if ( startIdx <= endIdx )
+		nPoints += endIdx-startIdx+1;
+
+	lastPoint = endIdx;
+	lastTime  = _grid.getTime( endIdx );
+
+	if ( _grid.hasTime( endTime,endHint ) == BT_FALSE )
+	{
+		lastTime = endTime;
+		++nPoints;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue VariablesGridView::selectValues(	uint startIdx,
+												uint endIdx
+												)
+{
+	if ( ( startIdx > endIdx ) || ( endIdx >= nValues ) )
+		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+	firstValue += startIdx;
+	nValues     = endIdx-startIdx+1;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+DVector VariablesGridView::getVector(	uint pointIdx
+										) const
+{
+	DVector tmp( nValues );
+
+	for( uint j=0; j<nValues; ++j )
+		tmp( j ) = operator()( pointIdx,j );
+
+	return tmp;
+}
+
+
+DVector VariablesGridView::getFirstVector( ) const
+{
+	if ( nPoints == 0 )
+		return emptyVector;
+
+	return getVector( 0 );
+}
+
+
+DVector VariablesGridView::getLastVector( ) const
+{
+	if ( nPoints == 0 )
+		return emptyVector;
+
+	return getVector( nPoints-1 );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,262 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/variables_grid/variables_grid_view.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_VARIABLES_GRID_VIEW_HPP
+#define ACADO_TOOLKIT_VARIABLES_GRID_VIEW_HPP
+
+
+#include <acado/variables_grid/variables_grid.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Provides a non-owning view on a time window or a range of components of a VariablesGrid.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class VariablesGridView refers to the grid points and vector components
+ *	of an existing VariablesGrid without copying them. It describes the same data
+ *	as the sub grids returned by VariablesGrid::getTimeSubGrid and
+ *	VariablesGrid::getValuesSubGrid, i.e. grid points at the boundaries of a time
+ *	window that do not coincide with points of the underlying grid are obtained by
+ *	constant interpolation.
+ *
+ *	A view is only valid as long as the underlying grid is neither modified nor
+ *	destroyed. Assigning a view to a VariablesGrid reuses the memory of the
+ *	latter whenever its dimensions match.
+ */
+class VariablesGridView
+{
+	friend class VariablesGrid;
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor, sets up an empty view.
+		 */
+        VariablesGridView( );
+
+        /** Constructor that sets up a view on all grid points and components
+		 *	of given grid.
+		 *
+		 *	@param[in] _grid		Grid to be viewed.
+		 */
+        VariablesGridView(	const VariablesGrid& _grid
+							);
+
+        /** Constructor that sets up a view on a time window of given grid,
+		 *	see init() for details.
+		 *
+		 *	@param[in] _grid		Grid to be viewed.
+		 *	@param[in] startTime	Time of first grid point of the view.
+		 *	@param[in] endTime		Time of last grid point of the view.
+		 *	@param[in] extrapolate	Flag indicating whether times beyond the last grid point are allowed.
+		 */
+        VariablesGridView(	const VariablesGrid& _grid,
+							double startTime,
+							double endTime,
+							BooleanType extrapolate = BT_FALSE
+							);
+
+        /** Destructor.
+		 */
+        ~VariablesGridView( );
+
+
+		/** Initializes the view on all grid points and components of given grid.
+		 *
+		 *	@param[in] _grid		Grid to be viewed.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue init(	const VariablesGrid& _grid
+							);
+
+		/** Initializes the view on the time window [startTime,endTime] of given
+		 *	grid. The view comprises the same grid points as the sub grid returned
+		 *	by VariablesGrid::getTimeSubGrid( startTime,endTime ). If extrapolate is
+		 *	BT_TRUE, the window may end after the last grid point; in this case the
+		 *	vector at the last grid point is held constant until endTime.
+		 *
+		 *	If the view has been initialized on the same grid before, the search for
+		 *	the grid points of the window starts at those of the previous window.
+		 *	Thus, re-initializing a view for sliding windows costs amortized O(1).
+		 *
+		 *	@param[in] _grid		Grid to be viewed.
+		 *	@param[in] startTime	Time of first grid point of the view.
+		 *	@param[in] endTime		Time of last grid point of the view.
+		 *	@param[in] extrapolate	Flag indicating whether times beyond the last grid point are allowed.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue init(	const VariablesGrid& _grid,
+							double startTime,
+							double endTime,
+							BooleanType extrapolate = BT_FALSE
+							);
+
+		/** Restricts the view to the components starting and ending at given
+		 *	indices (relative to the components currently comprised by the view).
+		 *
+		 *	@param[in] startIdx		Index of first component to be included in view.
+		 *	@param[in] endIdx		Index of last component to be included in view.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		returnValue selectValues(	uint startIdx,
+									uint endIdx
+									);
+
+
+		/** Returns number of grid points of the view.
+		 *
+		 *	\return Number of grid points
+		 */
+		inline uint getNumPoints( ) const;
+
+		/** Returns number of components of the view.
+		 *
+		 *	\return Number of components
+		 */
+		inline uint getNumValues( ) const;
+
+		/** Returns whether the view is empty.
+		 *
+		 *	\return BT_TRUE  iff view comprises no grid points, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isEmpty( ) const;
+
+		/** Returns time of grid point with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *	\return Time of grid point
+		 */
+		inline double getTime(	uint pointIdx
+								) const;
+
+		/** Returns time of first grid point of the view.
+		 *
+		 *	\return Time of first grid point
+		 */
+		inline double getFirstTime( ) const;
+
+		/** Returns time of last grid point of the view.
+		 *
+		 *	\return Time of last grid point
+		 */
+		inline double getLastTime( ) const;
+
+        /** Returns value of given component at grid point with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *	@param[in] rowIdx		Index of component (relative to the view).
+		 *
+		 *	\return Value of component
+		 */
+        inline double operator()(	uint pointIdx,
+									uint rowIdx
+									) const;
+
+		/** Returns (deep-copy of) vector at grid point with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *	\return Vector at grid point with given index
+		 */
+		DVector getVector(	uint pointIdx
+							) const;
+
+		/** Returns (deep-copy of) vector at first grid point of the view.
+		 *
+		 *	\return Vector at first grid point
+		 */
+		DVector getFirstVector( ) const;
+
+		/** Returns (deep-copy of) vector at last grid point of the view.
+		 *
+		 *	\return Vector at last grid point
+		 */
+		DVector getLastVector( ) const;
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+		/** Returns index of the grid point of the underlying grid that
+		 *	corresponds to grid point of the view with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point of the view.
+		 *
+		 *	\return Index of grid point of underlying grid
+		 */
+		inline uint getGridIndex(	uint pointIdx
+									) const;
+
+
+    //
+    // PROTECTED DATA MEMBERS:
+    //
+    protected:
+
+		const VariablesGrid* grid;		/**< Underlying grid (not owned). */
+
+		uint nPoints;					/**< Number of grid points of the view. */
+		uint firstPoint;				/**< Index of the grid point of the underlying grid corresponding to the first grid point of the view. */
+		uint lastPoint;					/**< Index of the last distinct grid point of the underlying grid; subsequent grid points of the view repeat its vector. */
+		double firstTime;				/**< Time of the first grid point of the view. */
+		double lastTime;				/**< Time of the last grid point of the view. */
+
+		uint firstValue;				/**< Index of the first component of the view. */
+		uint nValues;					/**< Number of components of the view. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/variables_grid/variables_grid_view.ipp>
+
+
+#endif  // ACADO_TOOLKIT_VARIABLES_GRID_VIEW_HPP
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,120 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/variables_grid/variables_grid_view.ipp
+ */
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+inline uint VariablesGridView::getNumPoints( ) const
+{
+	return nPoints;
+}
+
+
+inline uint VariablesGridView::getNumValues( ) const
+{
+	return nValues;
+}
+
+
+inline BooleanType VariablesGridView::isEmpty( ) const
+{
+	if ( nPoints == 0 )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+inline double VariablesGridView::getTime(	uint pointIdx
+											) const
+{
+	ASSERT( pointIdx < nPoints );
+
+	if ( pointIdx == 0 )
+		return firstTime;
+
+	if ( pointIdx == nPoints-1 )
+		return lastTime;
+
+	return grid->getTime( getGridIndex( pointIdx ) );
+}
+
+
+inline double VariablesGridView::getFirstTime( ) const
+{
+	return firstTime;
+}
+
+
+inline double VariablesGridView::getLastTime( ) const
+{
+	return lastTime;
+}
+
+
+inline double VariablesGridView::operator()(	uint pointIdx,
+												uint rowIdx
+												) const
+{
+	ASSERT( rowIdx < nValues );
+
+	return grid->operator()( getGridIndex( pointIdx ),firstValue+rowIdx );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+inline uint VariablesGridView::getGridIndex(	uint pointIdx
+												) const
+{
+	ASSERT( pointIdx < nPoints );
+
+	if ( firstPoint+pointIdx > lastPoint )
+		return lastPoint;
+	else
+		return firstPoint+pointIdx;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
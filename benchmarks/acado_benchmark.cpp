@@ -0,0 +1,307 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/acado_benchmark.cpp
+ *
+ *    Benchmark of the interpreted algorithms: integrators, OptimizationAlgorithm,
+ *    RealTimeAlgorithm in closed loop and the code export. The problems are
+ *    taken from the examples (CSTR, crane, pendulum DAE NMPC) with fixed data,
+ *    such that the results of different builds can be compared directly.
+ *
+ *    Usage: acado_benchmark [output.json]
+ */
+
+
+#include <acado_toolkit.hpp>
+#include <acado_code_generation.hpp>
+
+#include "benchmark_problems.hpp"
+#include "benchmark_report.hpp"
+
+
+USING_NAMESPACE_ACADO
+
+
+/** Adds the time and number of calls of the profiler sections with given names. */
+static void addProfilerSections(	BenchmarkReport& report,
+									const char* const* names,
+									unsigned nNames
+									)
+{
+	for( unsigned i=0; i<nNames; ++i )
+	{
+		double totalTime = 0.0;
+		uint numCalls = 0;
+
+		Profiler::getSectionTime( names[i],totalTime,numCalls );
+
+		report.addPhase( names[i],totalTime );
+		report.addCounter( std::string( names[i] ) + " calls",numCalls );
+	}
+}
+
+
+/** Integration of the CSTR model including first order forward sensitivities. */
+static void benchmarkIntegratorCSTR(	BenchmarkReport& report,
+										const std::string& name,
+										Integrator* (*createIntegrator)( DifferentialEquation& )
+										)
+{
+	clearAllStaticCounters( );
+	Profiler::reset( );
+
+	report.beginCase( name,"integrator" );
+
+	DifferentialState cA, cB, theta, thetaK;
+	Control u( "",2,1 );
+	DifferentialEquation f;
+
+	setupCSTR( f,cA,cB,theta,thetaK,u );
+
+	double tmp = BenchmarkReport::getTime( );
+	Integrator* integrator = createIntegrator( f );
+	integrator->set( INTEGRATOR_TOLERANCE,1.0e-8 );
+	double setupTime = BenchmarkReport::getTime( ) - tmp;
+
+	DVector x0( 4 ), uu( 2 ), seed( 4 );
+	x0(0) = 1.0; x0(1) = 0.5; x0(2) = 100.0; x0(3) = 100.0;
+	uu(0) = 14.19; uu(1) = -1113.5;
+	seed.setZero( );
+	seed(2) = 1.0;
+
+	Profiler::enable( );
+
+	returnValue returnvalue = integrator->freezeAll( );
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = integrator->integrate( 0.0,1500.0,x0,emptyVector,emptyVector,uu );
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = integrator->setForwardSeed( 1,seed );
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = integrator->integrateSensitivities( );
+
+	Profiler::disable( );
+
+	int nSteps    = integrator->getNumberOfSteps( );
+	int nRejected = integrator->getNumberOfRejectedSteps( );
+	delete integrator;
+
+	report.endCase( returnvalue == SUCCESSFUL_RETURN );
+	report.addPhase( "setup",setupTime );
+
+	const char* const sections[] = { "integration","integrator sensitivities","function evaluation","AD forward" };
+	addProfilerSections( report,sections,4 );
+
+	report.addCounter( "steps",nSteps );
+	report.addCounter( "rejected steps",nRejected );
+}
+
+static Integrator* createRK45( DifferentialEquation& f ) { return new IntegratorRK45( f ); }
+static Integrator* createBDF( DifferentialEquation& f )  { return new IntegratorBDF( f ); }
+
+
+/** Solution of the CSTR tracking problem (examples/ocp/cstr.cpp) by the OptimizationAlgorithm. */
+static void benchmarkOptimizationCSTR(	BenchmarkReport& report
+										)
+{
+	clearAllStaticCounters( );
+	Profiler::reset( );
+
+	report.beginCase( "ocp_cstr","optimization_algorithm" );
+
+	DifferentialState cA, cB, theta, thetaK;
+	Control u( "",2,1 );
+	DifferentialEquation f;
+
+	setupCSTR( f,cA,cB,theta,thetaK,u );
+
+	Function h;
+	h << cA << cB << theta << thetaK << u(0) << u(1);
+
+	DMatrix S = eye<double>( 6 );
+	S(0,0) = 0.2; S(1,1) = 1.0; S(2,2) = 0.5; S(3,3) = 0.2; S(4,4) = 0.5; S(5,5) = 0.0000005;
+
+	DVector r( 6 );
+	r(0) = 2.14; r(1) = 1.09; r(2) = 114.2; r(3) = 112.9; r(4) = 14.19; r(5) = -1113.5;
+
+	double times[ 11 ];
+	for( int i=0; i<10; ++i )
+		times[i] = i*80.0;
+	times[10] = 1500.0;
+
+	double tmp = BenchmarkReport::getTime( );
+
+	OCP ocp( Grid( 11,times ) );
+	ocp.minimizeLSQ( S,h,r );
+	ocp.subjectTo( f );
+	ocp.subjectTo( AT_START, cA     == 1.0 );
+	ocp.subjectTo( AT_START, cB     == 0.5 );
+	ocp.subjectTo( AT_START, theta  == 100.0 );
+	ocp.subjectTo( AT_START, thetaK == 100.0 );
+	ocp.subjectTo( 3.0     <= u(0) <= 35.0 );
+	ocp.subjectTo( -9000.0 <= u(1) <= 0.0 );
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set( PRINTLEVEL,NONE );
+	algorithm.set( PRINT_COPYRIGHT,NO );
+	algorithm.set( HESSIAN_APPROXIMATION,GAUSS_NEWTON );
+	algorithm.set( INTEGRATOR_TOLERANCE,1e-6 );
+	algorithm.set( KKT_TOLERANCE,1e-4 );
+
+	VariablesGrid uStart( 2,0.0,2000.0,2 );
+	uStart( 0,0 ) = 14.19; uStart( 0,1 ) = -1113.5;
+	uStart( 1,0 ) = 14.19; uStart( 1,1 ) = -1113.5;
+	algorithm.initializeControls( uStart );
+
+	double setupTime = BenchmarkReport::getTime( ) - tmp;
+
+	Profiler::enable( );
+	tmp = BenchmarkReport::getTime( );
+	returnValue returnvalue = algorithm.solve( );
+	double solveTime = BenchmarkReport::getTime( ) - tmp;
+	Profiler::disable( );
+
+	report.endCase( returnvalue == SUCCESSFUL_RETURN );
+	report.addPhase( "setup",setupTime );
+	report.addPhase( "solve",solveTime );
+
+	const char* const sections[] = { "SQP iteration","preparation step","feedback step","globalization","integration","integrator sensitivities" };
+	addProfilerSections( report,sections,6 );
+}
+
+
+/** Closed-loop NMPC of the crane (examples/simulation_environment/crane_mpc3.cpp) using the RealTimeAlgorithm. */
+static void benchmarkRealTimeCrane(	BenchmarkReport& report
+									)
+{
+	clearAllStaticCounters( );
+	Profiler::reset( );
+
+	report.beginCase( "nmpc_crane","real_time_algorithm" );
+
+	DifferentialState x, v, phi, dphi;
+	Control ax;
+
+	const double m = 1.0, g = 9.81, b = 0.2;
+	double L = 1.0;
+
+	DifferentialEquation f, fSim;
+
+	f << dot(x) ==  v;
+	f << dot(v) ==  ax;
+	f << dot(phi ) == dphi;
+	f << dot(dphi) == -g/L*sin(phi) -ax/L*cos(phi) - b/(m*L*L)*dphi;
+
+	L = 1.2;
+
+	fSim << dot(x) ==  v;
+	fSim << dot(v) ==  ax;
+	fSim << dot(phi ) == dphi;
+	fSim << dot(dphi) == -g/L*sin(phi) -ax/L*cos(phi) - b/(m*L*L)*dphi;
+
+	Function h;
+	h << x << v << phi << dphi;
+
+	DMatrix Q = eye<double>( 4 );
+	DVector r( 4 );
+	r.setZero( );
+
+	double tmp = BenchmarkReport::getTime( );
+
+	OCP ocp( 0.0,5.0,25 );
+	ocp.minimizeLSQ( Q,h,r );
+	ocp.subjectTo( f );
+	ocp.subjectTo( -5.0 <= ax <= 5.0 );
+
+	OutputFcn identity;
+	DynamicSystem dynamicSystem( fSim,identity );
+	Process process( dynamicSystem,INT_RK45 );
+
+	RealTimeAlgorithm alg( ocp,0.1 );
+	alg.set( PRINTLEVEL,NONE );
+	alg.set( PRINT_COPYRIGHT,NO );
+
+	StaticReferenceTrajectory zeroReference;
+	Controller controller( alg,zeroReference );
+
+	SimulationEnvironment sim( 0.0,5.0,process,controller );
+
+	DVector x0( 4 );
+	x0.setZero( );
+	x0(3) = 5.0;
+
+	returnValue returnvalue = sim.init( x0 );
+	double setupTime = BenchmarkReport::getTime( ) - tmp;
+
+	Profiler::enable( );
+	tmp = BenchmarkReport::getTime( );
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = sim.run( );
+	double runTime = BenchmarkReport::getTime( ) - tmp;
+	Profiler::disable( );
+
+	report.endCase( returnvalue == SUCCESSFUL_RETURN );
+	report.addPhase( "setup",setupTime );
+	report.addPhase( "run",runTime );
+
+	const char* const sections[] = { "preparation step","feedback step","integration","integrator sensitivities" };
+	addProfilerSections( report,sections,4 );
+}
+
+
+/** Export of the RTI solver for the pendulum DAE. */
+static void benchmarkExportPendulum(	BenchmarkReport& report
+										)
+{
+	clearAllStaticCounters( );
+
+	report.beginCase( "export_pendulum_dae_nmpc","code_export" );
+
+	double tmp = BenchmarkReport::getTime( );
+	returnValue returnvalue = exportPendulumDaeNmpc( "benchmark_export_pendulum_dae_nmpc" );
+	double exportTime = BenchmarkReport::getTime( ) - tmp;
+
+	report.endCase( returnvalue == SUCCESSFUL_RETURN );
+	report.addPhase( "export",exportTime );
+}
+
+
+int main( int argc, char* argv[] )
+{
+	BenchmarkReport report( "interpreted" );
+
+	benchmarkIntegratorCSTR( report,"integrator_cstr_rk45",createRK45 );
+	benchmarkIntegratorCSTR( report,"integrator_cstr_bdf",createBDF );
+	benchmarkOptimizationCSTR( report );
+	benchmarkRealTimeCrane( report );
+	benchmarkExportPendulum( report );
+
+	// iteration output of the algorithms goes to the standard output
+	if ( report.print( argc > 1 ? argv[1] : "acado_benchmark.json" ) == false )
+		return EXIT_FAILURE;
+
+	return report.isSuccessful( ) == true ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,127 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/benchmark_problems.cpp
+ */
+
+
+#include "benchmark_problems.hpp"
+
+
+USING_NAMESPACE_ACADO
+
+
+void setupCSTR(	DifferentialEquation& f,
+				DifferentialState& cA,
+				DifferentialState& cB,
+				DifferentialState& theta,
+				DifferentialState& thetaK,
+				Control& u
+				)
+{
+	const double k10 = 1.287e12, k20 = 1.287e12, k30 = 9.043e09;
+	const double E1  = -9758.3,  E2  = -9758.3,  E3  = -8560.0;
+	const double H1  = 4.2,      H2  = -11.0,    H3  = -41.85;
+	const double rho = 0.9342,   Cp  = 3.01,     kw  = 4032.0;
+	const double AR  = 0.215,    VR  = 10.0,     mK  = 5.0,   CPK = 2.0;
+
+	const double cA0 = 5.1, theta0 = 104.9;
+	const double TIMEUNITS_PER_HOUR = 3600.0;
+
+	IntermediateState k1, k2, k3;
+
+	k1 = k10*exp(E1/(273.15 +theta));
+	k2 = k20*exp(E2/(273.15 +theta));
+	k3 = k30*exp(E3/(273.15 +theta));
+
+	f << dot(cA) == (1/TIMEUNITS_PER_HOUR)*(u(0)*(cA0-cA) - k1*cA - k3*cA*cA);
+	f << dot(cB) == (1/TIMEUNITS_PER_HOUR)* (- u(0)*cB + k1*cA - k2*cB);
+	f << dot(theta) == (1/TIMEUNITS_PER_HOUR)*(u(0)*(theta0-theta) - (1/(rho*Cp)) *(k1*cA*H1 + k2*cB*H2 + k3*cA*cA*H3)+(kw*AR/(rho*Cp*VR))*(thetaK -theta));
+	f << dot(thetaK) == (1/TIMEUNITS_PER_HOUR)*((1/(mK*CPK))*(u(1) + kw*AR*(theta-thetaK)));
+}
+
+
+returnValue exportPendulumDaeNmpc(	const std::string& folder
+									)
+{
+	DifferentialState x, y, w, dx, dy, dw;
+	AlgebraicState mu;
+	Control F;
+	IntermediateState c, dc;
+
+	const double m = 1.0, mc = 1.0, L = 1.0, g = 9.81, p = 5.0;
+
+	c  = 0.5 * ((x - w) * (x - w) + y * y - L * L);
+	dc = dy * y + (dw - dx) * (w - x);
+
+	DifferentialEquation f;
+
+	f << 0 == dot( x ) - dx;
+	f << 0 == dot( y ) - dy;
+	f << 0 == dot( w ) - dw;
+	f << 0 == m * dot( dx ) + (x - w) * mu;
+	f << 0 == m * dot( dy ) + y * mu + m * g;
+	f << 0 == mc * dot( dw ) + (w - x) * mu  - F;
+	f << 0 == (x - w) * dot( dx ) + y * dot( dy ) + (w - x) * dot( dw )
+			- (-p * p * c - 2 * p * dc - dy * dy - (dw - dx) * (dw - dx));
+
+	Function rf, rfN;
+	rf << x << y << w << dx << dy << dw << F;
+	rfN << x << y << w << dx << dy << dw;
+
+	const int N  = 10;
+	const int Ni = 4;
+	const double Ts = 0.1;
+
+	DMatrix W = eye<double>( rf.getDim( ) );
+	DMatrix WN = eye<double>( rfN.getDim( ) ) * 10;
+
+	OCP ocp( 0.0,N * Ts,N );
+	ocp.subjectTo( f );
+	ocp.minimizeLSQ( W,rf );
+	ocp.minimizeLSQEndTerm( WN,rfN );
+	ocp.subjectTo( -20 <= F <= 20 );
+
+	OCPexport mpc( ocp );
+	mpc.set( HESSIAN_APPROXIMATION,GAUSS_NEWTON );
+	mpc.set( DISCRETIZATION_TYPE,MULTIPLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE,INT_IRK_RIIA3 );
+	mpc.set( NUM_INTEGRATOR_STEPS,N * Ni );
+	mpc.set( SPARSE_QP_SOLUTION,FULL_CONDENSING );
+	mpc.set( QP_SOLVER,QP_QPOASES );
+	mpc.set( HOTSTART_QP,YES );
+	mpc.set( CG_USE_TIMING_COUNTERS,YES );
+	mpc.set( GENERATE_TEST_FILE,NO );
+	mpc.set( GENERATE_MAKE_FILE,NO );
+
+	return mpc.exportCode( folder.c_str( ) );
+}
+
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,63 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/benchmark_problems.hpp
+ *
+ *    Problems of the benchmark suite shared by several benchmark executables.
+ */
+
+
+#ifndef ACADO_BENCHMARK_PROBLEMS_HPP
+#define ACADO_BENCHMARK_PROBLEMS_HPP
+
+
+#include <acado_toolkit.hpp>
+#include <acado_code_generation.hpp>
+
+
+/** Sets up the model of the continuous stirred tank reactor from
+ *	examples/ocp/cstr.cpp; u has to comprise two controls. */
+void setupCSTR(	ACADO::DifferentialEquation& f,
+				ACADO::DifferentialState& cA,
+				ACADO::DifferentialState& cB,
+				ACADO::DifferentialState& theta,
+				ACADO::DifferentialState& thetaK,
+				ACADO::Control& u
+				);
+
+/** Exports the RTI solver of the pendulum DAE from
+ *	examples/code_generation/mpc_mhe/pendulum_dae_nmpc.cpp into given folder,
+ *	including timing counters of all solver phases. */
+ACADO::returnValue exportPendulumDaeNmpc(	const std::string& folder
+											);
+
+
+#endif  // ACADO_BENCHMARK_PROBLEMS_HPP
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,273 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/benchmark_report.cpp
+ */
+
+
+#include "benchmark_report.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+
+//
+// ALLOCATION COUNTERS:
+//
+
+static std::atomic< unsigned long > numAllocations( 0 );
+static std::atomic< unsigned long > numAllocatedBytes( 0 );
+
+
+static void* countedAllocation( std::size_t size )
+{
+	++numAllocations;
+	numAllocatedBytes += size;
+
+	void* ptr = std::malloc( size > 0 ? size : 1 );
+	if ( ptr == 0 )
+		throw std::bad_alloc( );
+
+	return ptr;
+}
+
+
+void* operator new( std::size_t size )
+{
+	return countedAllocation( size );
+}
+
+void* operator new[]( std::size_t size )
+{
+	return countedAllocation( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+	std::free( ptr );
+}
+
+
+//
+// STRING FORMATTING:
+//
+
+static std::string jsonString( const std::string& str )
+{
+	std::string tmp( "\"" );
+
+	for( unsigned i=0; i<str.size( ); ++i )
+	{
+		const unsigned char c = (unsigned char)str[i];
+
+		if ( c == '"' || c == '\\' )
+		{
+			tmp += '\\';
+			tmp += str[i];
+		}
+		else if ( c < 0x20 )
+		{
+			// control characters are not allowed unescaped in JSON strings
+			char buffer[ 8 ];
+			std::snprintf( buffer,sizeof( buffer ),"\\u%04x",(unsigned)c );
+			tmp += buffer;
+		}
+		else
+			tmp += str[i];
+	}
+
+	return tmp + "\"";
+}
+
+static std::string jsonNumber( double value )
+{
+	char buffer[ 32 ];
+	std::snprintf( buffer,sizeof( buffer ),"%.9e",value );
+
+	return buffer;
+}
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+BenchmarkReport::BenchmarkReport(	const std::string& _suite
+									) : suite( _suite )
+{
+}
+
+
+void BenchmarkReport::beginCase(	const std::string& name,
+									const std::string& category
+									)
+{
+	Case tmp;
+
+	tmp.name              = name;
+	tmp.category          = category;
+	tmp.success           = false;
+	tmp.wallTime          = 0.0;
+	tmp.numAllocations    = 0;
+	tmp.numAllocatedBytes = 0;
+
+	cases.push_back( tmp );
+
+	resetAllocationCounters( );
+	cases.back( ).startTime = getTime( );
+}
+
+
+void BenchmarkReport::addPhase(	const std::string& name,
+								double seconds
+								)
+{
+	cases.back( ).phases.push_back( std::make_pair( name,seconds ) );
+}
+
+
+void BenchmarkReport::addCounter(	const std::string& name,
+									long value
+									)
+{
+	cases.back( ).counters.push_back( std::make_pair( name,value ) );
+}
+
+
+void BenchmarkReport::endCase(	bool success
+								)
+{
+	Case& current = cases.back( );
+
+	current.wallTime          = getTime( ) - current.startTime;
+	current.numAllocations    = getNumAllocations( );
+	current.numAllocatedBytes = getNumAllocatedBytes( );
+	current.success           = success;
+}
+
+
+bool BenchmarkReport::isSuccessful( ) const
+{
+	for( unsigned i=0; i<cases.size( ); ++i )
+		if ( cases[i].success == false )
+			return false;
+
+	return true;
+}
+
+
+void BenchmarkReport::print(	std::ostream& stream
+								) const
+{
+	stream << "{\n  \"suite\": " << jsonString( suite ) << ",\n  \"benchmarks\": [";
+
+	for( unsigned i=0; i<cases.size( ); ++i )
+	{
+		const Case& c = cases[i];
+
+		stream << ( i > 0 ? "," : "" ) << "\n    {\n";
+		stream << "      \"name\": "      << jsonString( c.name )     << ",\n";
+		stream << "      \"category\": "  << jsonString( c.category ) << ",\n";
+		stream << "      \"success\": "   << ( c.success == true ? "true" : "false" ) << ",\n";
+		stream << "      \"wall_time\": " << jsonNumber( c.wallTime ) << ",\n";
+
+		stream << "      \"phases\": {";
+		for( unsigned j=0; j<c.phases.size( ); ++j )
+			stream << ( j > 0 ? ", " : " " ) << jsonString( c.phases[j].first ) << ": " << jsonNumber( c.phases[j].second );
+		stream << " },\n";
+
+		stream << "      \"counters\": {";
+		for( unsigned j=0; j<c.counters.size( ); ++j )
+			stream << ( j > 0 ? ", " : " " ) << jsonString( c.counters[j].first ) << ": " << c.counters[j].second;
+		stream << " },\n";
+
+		stream << "      \"allocations\": { \"count\": " << c.numAllocations
+			   << ", \"bytes\": " << c.numAllocatedBytes << " }\n";
+		stream << "    }";
+	}
+
+	stream << "\n  ]\n}\n";
+}
+
+
+bool BenchmarkReport::print(	const std::string& fileName
+								) const
+{
+	if ( fileName.empty( ) == true )
+	{
+		print( std::cout );
+		return true;
+	}
+
+	std::ofstream stream( fileName.c_str( ) );
+	if ( stream.is_open( ) == false )
+		return false;
+
+	print( stream );
+
+	return stream.good( );
+}
+
+
+double BenchmarkReport::getTime( )
+{
+	return std::chrono::duration< double >( std::chrono::steady_clock::now( ).time_since_epoch( ) ).count( );
+}
+
+
+unsigned long BenchmarkReport::getNumAllocations( )
+{
+	return numAllocations;
+}
+
+
+unsigned long BenchmarkReport::getNumAllocatedBytes( )
+{
+	return numAllocatedBytes;
+}
+
+
+void BenchmarkReport::resetAllocationCounters( )
+{
+	numAllocations    = 0;
+	numAllocatedBytes = 0;
+}
+
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,165 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/benchmark_report.hpp
+ */
+
+
+#ifndef ACADO_BENCHMARK_REPORT_HPP
+#define ACADO_BENCHMARK_REPORT_HPP
+
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/**
+ *	\brief Collects the results of a benchmark run and prints them as JSON.
+ *
+ *	A report consists of a sequence of benchmark cases. Each case records its
+ *	wall time, the wall time of individual phases, integral counters (e.g.
+ *	iteration counts) as well as the number and size of all heap allocations
+ *	performed between beginCase() and endCase(). Allocations are counted by
+ *	the replacement of the global operators new and delete that is linked
+ *	into every benchmark executable.
+ *
+ *	The output is a single JSON document of the form
+ *
+ *	{ "suite": ..., "benchmarks": [ { "name": ..., "category": ...,
+ *	  "wall_time": ..., "phases": {...}, "counters": {...},
+ *	  "allocations": { "count": ..., "bytes": ... } }, ... ] }
+ *
+ *	All times are given in seconds.
+ */
+class BenchmarkReport
+{
+	public:
+
+		/** Constructor.
+		 *
+		 *	@param[in] _suite	Name of the benchmark suite.
+		 */
+		BenchmarkReport(	const std::string& _suite
+							);
+
+		/** Starts a new benchmark case and resets the allocation counters.
+		 *
+		 *	@param[in] name		Name of the case.
+		 *	@param[in] category	Category of the case (e.g. "integrator").
+		 */
+		void beginCase(	const std::string& name,
+						const std::string& category
+						);
+
+		/** Adds wall time of a phase to the current (or most recently finished)
+		 *	case. Phases and counters are usually added after endCase() such that
+		 *	their bookkeeping does not show up in the allocation counts.
+		 *
+		 *	@param[in] name		Name of the phase.
+		 *	@param[in] seconds	Wall time of the phase.
+		 */
+		void addPhase(	const std::string& name,
+						double seconds
+						);
+
+		/** Adds an integral counter to the current (or most recently finished) case.
+		 *
+		 *	@param[in] name		Name of the counter.
+		 *	@param[in] value	Value of the counter.
+		 */
+		void addCounter(	const std::string& name,
+							long value
+							);
+
+		/** Finishes the current case.
+		 *
+		 *	@param[in] success	Flag indicating whether the case has been run successfully.
+		 */
+		void endCase(	bool success = true
+						);
+
+		/** Returns whether all cases have been run successfully. */
+		bool isSuccessful( ) const;
+
+		/** Prints the report as JSON document.
+		 *
+		 *	@param[in] stream	Output stream.
+		 */
+		void print(	std::ostream& stream
+					) const;
+
+		/** Prints the report to the file with given name or, if the name is
+		 *	empty, to the standard output.
+		 *
+		 *	@param[in] fileName	Name of the output file.
+		 *
+		 *	\return true iff report could be written
+		 */
+		bool print(	const std::string& fileName
+					) const;
+
+
+		/** Returns the current time of a monotonic clock in seconds. */
+		static double getTime( );
+
+		/** Returns number of heap allocations since the last reset. */
+		static unsigned long getNumAllocations( );
+
+		/** Returns number of bytes allocated on the heap since the last reset. */
+		static unsigned long getNumAllocatedBytes( );
+
+		/** Resets the allocation counters. */
+		static void resetAllocationCounters( );
+
+
+	protected:
+
+		/** Results of a single benchmark case. */
+		struct Case
+		{
+			std::string name;
+			std::string category;
+			bool success;
+			double startTime;
+			double wallTime;
+			std::vector< std::pair< std::string,double > > phases;
+			std::vector< std::pair< std::string,long > > counters;
+			unsigned long numAllocations;
+			unsigned long numAllocatedBytes;
+		};
+
+		std::string suite;				/**< Name of the benchmark suite. */
+		std::vector< Case > cases;		/**< Results of all cases. */
+};
+
+
+#endif  // ACADO_BENCHMARK_REPORT_HPP
+
+/*
+ *	end of file
+ */
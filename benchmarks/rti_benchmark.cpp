@@ -0,0 +1,140 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/rti_benchmark.cpp
+ *
+ *    Benchmark of the generated RTI solver for the pendulum DAE, run in closed
+ *    loop with ideal state feedback (cf. pendulum_dae_nmpc_test.cpp). Besides
+ *    the wall time of all preparation and feedback steps, the tick counts of
+ *    the timing counters of the individual solver phases are reported.
+ *
+ *    Usage: rti_benchmark [output.json]
+ */
+
+
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#include "benchmark_report.hpp"
+
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NU          ACADO_NU	/* number of control inputs */
+#define N           ACADO_N		/* number of control intervals */
+#define NY          ACADO_NY	/* number of references, nodes 0..N - 1 */
+#define NYN         ACADO_NYN	/* number of references, node N */
+#define NUM_STEPS   100			/* number of real-time iterations */
+
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+
+int main( int argc, char* argv[] )
+{
+	BenchmarkReport report( "generated" );
+
+	unsigned i, nSteps;
+	int status = 0;
+	long nQPIterations = 0;
+	double preparationTime = 0.0, feedbackTime = 0.0, tmp;
+
+	report.beginCase( "rti_pendulum_dae_nmpc","generated_rti" );
+
+	memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));
+	memset(&acadoVariables, 0, sizeof( acadoVariables ));
+
+	initializeSolver( );
+
+	for (i = 0; i < N + 1; ++i)
+	{
+		acadoVariables.x[i * NX + 0] = 1;
+		acadoVariables.x[i * NX + 1] = sqrt(1.0 - 0.1 * 0.1);
+		acadoVariables.x[i * NX + 2] = 0.9;
+	}
+
+	for (i = 0; i < N; ++i)
+		acadoVariables.y[i * NY + 1] = 1.0;
+	acadoVariables.yN[ 1 ] = 1.0;
+
+	for (i = 0; i < NX; ++i)
+		acadoVariables.x0[ i ] = acadoVariables.x[ i ];
+
+	resetTimingCounters( );
+
+	tmp = BenchmarkReport::getTime( );
+	preparationStep( );
+	preparationTime += BenchmarkReport::getTime( ) - tmp;
+
+	for (nSteps = 0; nSteps < NUM_STEPS; ++nSteps)
+	{
+		tmp = BenchmarkReport::getTime( );
+		status = feedbackStep( );
+		feedbackTime += BenchmarkReport::getTime( ) - tmp;
+
+		if ( status )
+			break;
+
+		nQPIterations += getNWSR( );
+
+		// ideal feedback, i.e. the predicted state of the next sampling interval
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+
+		shiftStates(2, 0, 0);
+		shiftControls( 0 );
+
+		tmp = BenchmarkReport::getTime( );
+		preparationStep( );
+		preparationTime += BenchmarkReport::getTime( ) - tmp;
+	}
+
+	report.endCase( status == 0 );
+
+	report.addPhase( "preparation step",preparationTime );
+	report.addPhase( "feedback step",feedbackTime );
+
+	const char* const phases[ ACADO_TIMING_NUM_PHASES ] = {
+		"preparation","feedback","integration","objective","regularization",
+		"condensing (preparation)","condensing (feedback)","qp","expansion"
+	};
+
+	for (i = 0; i < ACADO_TIMING_NUM_PHASES; ++i)
+		report.addCounter( std::string( phases[ i ] ) + " ticks",(long)acadoTimings.phase[ i ].total );
+
+	report.addCounter( "real-time iterations",nSteps );
+	report.addCounter( "qp iterations",nQPIterations );
+
+	if ( report.print( argc > 1 ? argv[1] : "" ) == false )
+		return EXIT_FAILURE;
+
+	return report.isSuccessful( ) == true ? EXIT_SUCCESS : EXIT_FAILURE;
+}
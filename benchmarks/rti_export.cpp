@@ -0,0 +1,48 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file benchmarks/rti_export.cpp
+ *
+ *    Exports the RTI solver benchmarked by rti_benchmark.cpp.
+ *
+ *    Usage: rti_export <export folder>
+ */
+
+
+#include "benchmark_problems.hpp"
+
+
+int main( int argc, char* argv[] )
+{
+	if ( argc < 2 )
+		return EXIT_FAILURE;
+
+	if ( exportPendulumDaeNmpc( argv[1] ) != ACADO::SUCCESSFUL_RETURN )
+		return EXIT_FAILURE;
+
+	return EXIT_SUCCESS;
+}
@@ -88,12 +88,43 @@ bool SharedObject::isNull() const{
   return node==0;
 }
 
+int SharedObject::concurrent_access_ = 0;
+
+void SharedObject::beginConcurrentAccess(){
+#if defined(__GNUC__)
+  __sync_add_and_fetch(&concurrent_access_,1);
+#else
+  concurrent_access_++;
+#endif
+}
+
+void SharedObject::endConcurrentAccess(){
+#if defined(__GNUC__)
+  __sync_sub_and_fetch(&concurrent_access_,1);
+#else
+  concurrent_access_--;
+#endif
+}
+
+// The reference counter is only updated atomically while objects may be shared
+// between threads (e.g. when ACADO exports several files concurrently)
 void SharedObject::count_up(){
-  if(node) node->count++;  
+  if(node==0) return;
+#if defined(__GNUC__)
+  if(concurrent_access_) __sync_add_and_fetch(&node->count,1);
+  else node->count++;
+#else
+  node->count++;
+#endif
 }
 
 void SharedObject::count_down(){
-  if(node && --node->count == 0){
+  if(node==0) return;
+#if defined(__GNUC__)
+  if(concurrent_access_ ? __sync_sub_and_fetch(&node->count,1) == 0 : --node->count == 0){
+#else
+  if(--node->count == 0){
+#endif
     delete node;
     node = 0;
   }  
@@ -116,6 +116,14 @@ class SharedObject : public PrintableObject{
     /// Print a destription of the object
     virtual void print(std::ostream &stream=std::cout) const;
     
+    /** \brief Count references atomically until the matching endConcurrentAccess()
+        Call before objects are shared between threads, and only after all these threads
+        are joined call endConcurrentAccess(). Calls may be nested. */
+    static void beginConcurrentAccess();
+
+    /// End a section started by beginConcurrentAccess()
+    static void endConcurrentAccess();
+    
     #endif // SWIG
     
     /// Initialize the object: more documentation in the node class (SharedObjectNode and derived classes)
@@ -144,6 +152,7 @@ class SharedObject : public PrintableObject{
     SharedObjectNode *node;
     void count_up(); // increase counter of the node
     void count_down(); // decrease counter of the node
+    static int concurrent_access_; // number of sections started by beginConcurrentAccess()
 #endif // SWIG
 };
 
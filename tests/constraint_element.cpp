@@ -0,0 +1,242 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE ConstraintElementTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/constraint/path_constraint.hpp>
+#include <acado/objective/lsq_end_term.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/*
+ *	All tests use the mixed function
+ *
+ *		h(x,u) = ( x1 + 2*u,  x1*x2,  3*x2 - u + 1,  sin(u)*x1 ),
+ *
+ *	whose first and third components are affine, such that their Jacobian
+ *	rows are cached after the first backward evaluation.
+ */
+
+static const unsigned nh = 4;
+
+static void makeExpressions( const DifferentialState& x1, const DifferentialState& x2,
+							 const Control& u, Expression* h )
+{
+	h[ 0 ] = x1 + 2.0 * u;
+	h[ 1 ] = x1 * x2;
+	h[ 2 ] = 3.0 * x2 - u + 1.0;
+	h[ 3 ] = sin( u ) * x1;
+}
+
+static void addConstraints( PathConstraint& constraint, const Expression* h )
+{
+	DVector lb( 3 ), ub( 3 );
+	lb.setAll( -10.0 );
+	ub.setAll( 10.0 );
+
+	for (unsigned k = 0; k < nh; ++k)
+		BOOST_REQUIRE( constraint.add(lb, h[ k ], ub) == SUCCESSFUL_RETURN );
+}
+
+/** Jacobian of h w.r.t. (x1,x2,u). */
+static DMatrix referenceJacobian( double x1, double x2, double u )
+{
+	DMatrix J( nh,3 );
+	J.setZero( );
+
+	J(0, 0) = 1.0;       J(0, 2) = 2.0;
+	J(1, 0) = x2;        J(1, 1) = x1;
+	J(2, 1) = 3.0;       J(2, 2) = -1.0;
+	J(3, 0) = sin( u );  J(3, 2) = cos( u ) * x1;
+
+	return J;
+}
+
+/** Iterate on a grid of three points, whose values depend on the offset. */
+static void makeIterate( double offset, VariablesGrid& x, VariablesGrid& u )
+{
+	x.init( 2,Grid( 0.0,1.0,3 ) );
+	u.init( 1,Grid( 0.0,1.0,3 ) );
+
+	for (unsigned i = 0; i < x.getNumPoints(); ++i)
+	{
+		x(i, 0) = offset + 0.5 * i;
+		x(i, 1) = 1.0 - offset * i;
+		u(i, 0) = 0.3 * offset - 0.2 * i;
+	}
+}
+
+static void requireClose( const DMatrix& a, const DMatrix& b )
+{
+	BOOST_REQUIRE_EQUAL(a.getNumRows(), b.getNumRows());
+	BOOST_REQUIRE_EQUAL(a.getNumCols(), b.getNumCols());
+
+	for (unsigned i = 0; i < a.getNumRows(); ++i)
+		for (unsigned j = 0; j < a.getNumCols(); ++j)
+			BOOST_REQUIRE_SMALL(a(i, j) - b(i, j), 1e-12);
+}
+
+/** Jacobians of the path constraint w.r.t. x and u at all grid points; unscaled seeds are set as identities. */
+static void pathConstraintJacobians(	PathConstraint& constraint, const OCPiterate& iter, double seedScaling,
+										vector< DMatrix >& Dx, vector< DMatrix >& Du )
+{
+	const unsigned N = iter.x->getNumPoints();
+
+	BOOST_REQUIRE( constraint.init( iter ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( constraint.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+	BlockMatrix seed( 1,N );
+	for (unsigned i = 0; i < N; ++i)
+	{
+		if ( seedScaling == 1.0 )
+			seed.setIdentity(0, i, nh);
+		else
+			seed.setDense(0, i, seedScaling * eye<double>( nh ));
+	}
+
+	BOOST_REQUIRE( constraint.setBackwardSeed(&seed, 1) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( constraint.evaluateSensitivities( ) == SUCCESSFUL_RETURN );
+
+	BlockMatrix D;
+	BOOST_REQUIRE( constraint.getBackwardSensitivities(&D, 1) == SUCCESSFUL_RETURN );
+
+	Dx.resize( N );
+	Du.resize( N );
+	for (unsigned i = 0; i < N; ++i)
+	{
+		D.getSubBlock(i, i, Dx[ i ], nh, 2);
+		D.getSubBlock(i, 3 * N + i, Du[ i ], nh, 1);
+		Dx[ i ] /= seedScaling;
+		Du[ i ] /= seedScaling;
+	}
+}
+
+BOOST_AUTO_TEST_CASE( cached_constraint_jacobian_matches_ad )
+{
+	// the variables of each test are numbered from zero
+	clearAllStaticCounters( );
+
+	DifferentialState x1, x2;
+	Control u;
+	Expression h[ nh ];
+	makeExpressions(x1, x2, u, h);
+
+	PathConstraint constraint( Grid( 0.0,1.0,3 ) );
+	addConstraints(constraint, h);
+
+	// An identity seed takes the compressed path, which caches the affine
+	// rows in the first evaluation and reuses them in the second one. A
+	// dense seed on a new constraint differentiates every row on its own.
+	for (unsigned k = 0; k < 2; ++k)
+	{
+		VariablesGrid x, uGrid;
+		makeIterate(0.7 + k, x, uGrid);
+		OCPiterate iter( &x,0,0,&uGrid,0 );
+
+		vector< DMatrix > Dx, Du, DxRef, DuRef;
+		pathConstraintJacobians(constraint, iter, 1.0, Dx, Du);
+
+		PathConstraint fresh( Grid( 0.0,1.0,3 ) );
+		addConstraints(fresh, h);
+		pathConstraintJacobians(fresh, iter, 2.0, DxRef, DuRef);
+
+		for (unsigned i = 0; i < x.getNumPoints(); ++i)
+		{
+			DMatrix J = referenceJacobian(x(i, 0), x(i, 1), uGrid(i, 0));
+
+			requireClose(Dx[ i ], DxRef[ i ]);
+			requireClose(Du[ i ], DuRef[ i ]);
+			requireClose(Dx[ i ], J.block(0, 0, nh, 2));
+			requireClose(Du[ i ], J.block(0, 2, nh, 1));
+		}
+	}
+}
+
+/** Gradient and Gauss-Newton Hessian blocks of the end term w.r.t. x and u. */
+static void endTermSensitivities(	LSQEndTerm& term, const OCPiterate& iter,
+									DMatrix& Dx, DMatrix& Du, DMatrix& Hxx, DMatrix& Hxu, DMatrix& Huu )
+{
+	const unsigned N = iter.x->getNumPoints();
+
+	BOOST_REQUIRE( term.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+	BlockMatrix seed( 1,1 );
+	seed.setDense(0, 0, eye<double>( 1 ));
+	BOOST_REQUIRE( term.setBackwardSeed(&seed, 1) == SUCCESSFUL_RETURN );
+
+	BlockMatrix hessian( 5 * N,5 * N );
+	BOOST_REQUIRE( term.evaluateSensitivitiesGN( &hessian ) == SUCCESSFUL_RETURN );
+
+	BlockMatrix D;
+	BOOST_REQUIRE( term.getBackwardSensitivities(&D, 1) == SUCCESSFUL_RETURN );
+
+	const unsigned xIdx = N - 1, uIdx = 4 * N - 1;
+	D.getSubBlock(0, xIdx, Dx, 1, 2);
+	D.getSubBlock(0, uIdx, Du, 1, 1);
+	hessian.getSubBlock(xIdx, xIdx, Hxx, 2, 2);
+	hessian.getSubBlock(xIdx, uIdx, Hxu, 2, 1);
+	hessian.getSubBlock(uIdx, uIdx, Huu, 1, 1);
+}
+
+BOOST_AUTO_TEST_CASE( cached_objective_jacobian_matches_ad )
+{
+	// the variables of each test are numbered from zero
+	clearAllStaticCounters( );
+
+	DifferentialState x1, x2;
+	Control u;
+	Expression h[ nh ];
+	makeExpressions(x1, x2, u, h);
+
+	Function m;
+	for (unsigned k = 0; k < nh; ++k)
+		m << h[ k ];
+
+	const Grid grid( 0.0,1.0,3 );
+	LSQEndTerm term( grid,eye<double>( nh ),m,zeros<double>( nh ) );
+
+	// The second evaluation of the term reuses the cached affine rows, a
+	// new term differentiates all of them
+	for (unsigned k = 0; k < 2; ++k)
+	{
+		VariablesGrid x, uGrid;
+		makeIterate(0.7 + k, x, uGrid);
+		OCPiterate iter( &x,0,0,&uGrid,0 );
+
+		DMatrix Dx, Du, Hxx, Hxu, Huu;
+		endTermSensitivities(term, iter, Dx, Du, Hxx, Hxu, Huu);
+
+		LSQEndTerm fresh( grid,eye<double>( nh ),m,zeros<double>( nh ) );
+		DMatrix DxRef, DuRef, HxxRef, HxuRef, HuuRef;
+		endTermSensitivities(fresh, iter, DxRef, DuRef, HxxRef, HxuRef, HuuRef);
+
+		requireClose(Dx, DxRef);
+		requireClose(Du, DuRef);
+		requireClose(Hxx, HxxRef);
+		requireClose(Hxu, HxuRef);
+		requireClose(Huu, HuuRef);
+
+		// gradient J^T*h and Gauss-Newton Hessian J^T*J
+		const unsigned last = grid.getLastIndex();
+		const double x1Val = x(last, 0), x2Val = x(last, 1), uVal = uGrid(last, 0);
+
+		DMatrix J = referenceJacobian(x1Val, x2Val, uVal);
+		DVector hVal( nh );
+		hVal(0) = x1Val + 2.0 * uVal;
+		hVal(1) = x1Val * x2Val;
+		hVal(2) = 3.0 * x2Val - uVal + 1.0;
+		hVal(3) = sin( uVal ) * x1Val;
+
+		DMatrix gradient = J.transpose() * hVal;
+		DMatrix gnHessian = J.transpose() * J;
+
+		requireClose(Dx, gradient.block(0, 0, 2, 1).transpose());
+		requireClose(Du, gradient.block(2, 0, 1, 1));
+		requireClose(Hxx, gnHessian.block(0, 0, 2, 2));
+		requireClose(Hxu, gnHessian.block(0, 2, 2, 1));
+		requireClose(Huu, gnHessian.block(2, 2, 1, 1));
+	}
+}
@@ -0,0 +1,120 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE EllipsoidalIntegratorTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/validated_integrator/ellipsoidal_integrator.hpp>
+
+#include <vector>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+typedef vector< Tmatrix<Interval> > Boxes;
+
+/** Partitions [1.1,1.3] x [1.0,1.2] into 2 x 3 boxes. */
+static Boxes makeBoxes( )
+{
+	Boxes boxes;
+
+	for (unsigned i = 0; i < 2; ++i)
+		for (unsigned j = 0; j < 3; ++j)
+		{
+			Tmatrix<Interval> x( 2 );
+			x( 0 ) = Interval(1.1 + 0.1 * i, 1.2 + 0.1 * i);
+			x( 1 ) = Interval(1.0 + 0.2 / 3.0 * j, 1.0 + 0.2 / 3.0 * (j + 1));
+			boxes.push_back( x );
+		}
+
+	return boxes;
+}
+
+static void requireEqual( const Boxes& a, const Boxes& b )
+{
+	BOOST_REQUIRE_EQUAL(a.size(), b.size());
+
+	for (unsigned i = 0; i < a.size(); ++i)
+	{
+		BOOST_REQUIRE_EQUAL(a[ i ].getDim(), b[ i ].getDim());
+		for (unsigned j = 0; j < a[ i ].getDim(); ++j)
+		{
+			BOOST_REQUIRE_EQUAL(a[ i ]( j ).l(), b[ i ]( j ).l());
+			BOOST_REQUIRE_EQUAL(a[ i ]( j ).u(), b[ i ]( j ).u());
+		}
+	}
+}
+
+static void setupIntegrator( EllipsoidalIntegrator& integrator, int numThreads )
+{
+	integrator.set( INTEGRATOR_PRINTLEVEL , NONE );
+	integrator.set( INTEGRATOR_TOLERANCE  , 1e-4 );
+	integrator.set( ABSOLUTE_TOLERANCE    , 1e-4 );
+	integrator.set( NUM_INTEGRATOR_THREADS, numThreads );
+}
+
+BOOST_AUTO_TEST_CASE( enclosures_do_not_depend_on_threads )
+{
+	DifferentialState x, y;
+	DifferentialEquation f;
+
+	f << dot(x) == x*(1.0-y);
+	f << dot(y) == y*(x-1.0);
+
+	const Boxes boxes = makeBoxes( );
+
+	// All integrators are copies of one prototype, so they share the same
+	// Taylor expansion of the right-hand side
+	EllipsoidalIntegrator prototype( f, 3 );
+
+	EllipsoidalIntegrator serial( prototype );
+	setupIntegrator(serial, 1);
+	const Boxes serialBounds = serial.integrate( 0.0, 0.5, 2, boxes );
+
+	// Integrating the boxes leaves the integrator as it was
+	requireEqual(serial.integrate( 0.0, 0.5, 2, boxes ), serialBounds);
+
+	for (int numThreads = 2; numThreads <= 8; numThreads *= 2)
+	{
+		EllipsoidalIntegrator parallel( prototype );
+		setupIntegrator(parallel, numThreads);
+
+		requireEqual(parallel.integrate( 0.0, 0.5, 2, boxes ), serialBounds);
+		requireEqual(parallel.integrate( 0.0, 0.5, 2, boxes ), serialBounds);
+	}
+
+	// Each enclosure is the one of the box integrated on its own
+	for (unsigned i = 0; i < boxes.size(); ++i)
+	{
+		EllipsoidalIntegrator single( prototype );
+		setupIntegrator(single, 1);
+
+		requireEqual(Boxes(1, single.integrate( 0.0, 0.5, 2, boxes[ i ] )), Boxes(1, serialBounds[ i ]));
+	}
+}
+
+BOOST_AUTO_TEST_CASE( enclosures_with_parameters_do_not_depend_on_threads )
+{
+	DifferentialState x, y;
+	Parameter p;
+	DifferentialEquation f;
+
+	f << dot(x) == p*x*(1.0-y);
+	f << dot(y) == p*y*(x-1.0);
+
+	const Boxes boxes = makeBoxes( );
+
+	Tmatrix<Interval> pBox( 1 );
+	pBox( 0 ) = Interval(2.95, 3.05);
+
+	EllipsoidalIntegrator prototype( f, 3 );
+
+	EllipsoidalIntegrator serial( prototype );
+	setupIntegrator(serial, 1);
+	const Boxes serialBounds = serial.integrate( 0.0, 0.2, 2, boxes, pBox );
+
+	EllipsoidalIntegrator parallel( prototype );
+	setupIntegrator(parallel, 4);
+	requireEqual(parallel.integrate( 0.0, 0.2, 2, boxes, pBox ), serialBounds);
+}
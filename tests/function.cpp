@@ -0,0 +1,224 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE FunctionTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/function/function.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+BOOST_AUTO_TEST_CASE( compressed_jacobian_matches_dense )
+{
+	DifferentialState x1, x2, x3, x4;
+	Control u;
+
+	Function f;
+	f << x1 * x2;
+	f << sin( x3 );
+	f << x4 + 2.0 * u;
+	f << x1 * x1;
+
+	BMatrix pattern;
+	BOOST_REQUIRE( f.getDependencyPattern( pattern ) == SUCCESSFUL_RETURN );
+
+	const int nVars = f.getNumberOfVariables();
+	BOOST_REQUIRE_EQUAL(pattern.getNumRows(), 4u);
+	BOOST_REQUIRE_EQUAL(pattern.getNumCols(), (unsigned)nVars + 1);
+
+	BOOST_REQUIRE( pattern(0, f.index(VT_DIFFERENTIAL_STATE, 1)) == true );
+	BOOST_REQUIRE( pattern(0, f.index(VT_DIFFERENTIAL_STATE, 2)) == false );
+	BOOST_REQUIRE( pattern(2, f.index(VT_CONTROL, 0)) == true );
+	BOOST_REQUIRE( pattern(3, f.index(VT_DIFFERENTIAL_STATE, 0)) == true );
+	BOOST_REQUIRE( pattern(3, f.index(VT_DIFFERENTIAL_STATE, 1)) == false );
+
+	// Columns of the same color never share a row
+	JacobianCompression compression( pattern );
+	BOOST_REQUIRE_EQUAL(compression.getNumColors(), 2u);
+
+	for (unsigned i = 0; i < pattern.getNumRows(); ++i)
+		for (unsigned j = 0; j < pattern.getNumCols(); ++j)
+			for (unsigned k = j + 1; k < pattern.getNumCols(); ++k)
+				if (pattern(i, j) == true && pattern(i, k) == true)
+					BOOST_REQUIRE( compression.getColor( j ) != compression.getColor( k ) );
+
+	// One forward sweep per color yields the full Jacobian
+	vector< double > x(nVars + 1, 0.0), result( 4 ), seed(nVars + 1), df( 4 );
+	for (int j = 0; j < nVars; ++j)
+		x[ j ] = 0.5 + j;
+	BOOST_REQUIRE( f.evaluate(0, &x[ 0 ], &result[ 0 ]) == SUCCESSFUL_RETURN );
+
+	DMatrix dense(4, nVars + 1), compressed(4, compression.getNumColors()), jacobian;
+	DMatrix S = compression.getSeed();
+
+	for (int j = 0; j <= nVars; ++j)
+	{
+		fill(seed.begin(), seed.end(), 0.0);
+		seed[ j ] = 1.0;
+		BOOST_REQUIRE( f.AD_forward(0, &seed[ 0 ], &df[ 0 ]) == SUCCESSFUL_RETURN );
+		for (unsigned i = 0; i < 4; ++i)
+			dense(i, j) = df[ i ];
+	}
+
+	for (unsigned c = 0; c < compression.getNumColors(); ++c)
+	{
+		for (int j = 0; j <= nVars; ++j)
+			seed[ j ] = S(j, c);
+		BOOST_REQUIRE( f.AD_forward(0, &seed[ 0 ], &df[ 0 ]) == SUCCESSFUL_RETURN );
+		for (unsigned i = 0; i < 4; ++i)
+			compressed(i, c) = df[ i ];
+	}
+
+	BOOST_REQUIRE( compression.decompress(compressed, jacobian) == SUCCESSFUL_RETURN );
+	for (unsigned i = 0; i < 4; ++i)
+		for (int j = 0; j <= nVars; ++j)
+			BOOST_REQUIRE( acadoIsEqual(jacobian(i, j), dense(i, j)) );
+}
+
+BOOST_AUTO_TEST_CASE( vector_mode_matches_single_direction )
+{
+	DifferentialState x1, x2, x3;
+	Control u;
+	IntermediateState s;
+
+	s = x1 * x2 + exp( x3 );
+
+	Function f;
+	f << s / ( 1.0 + x2 * x2 );
+	f << pow( x1, x3 ) - 3.0 * u;
+	f << s * s + x1 * x1 * x1;
+
+	const int nVars = f.getNumberOfVariables() + 1;
+	const int nDirs = 3;
+
+	vector< double > x(nVars, 0.0), result( 3 );
+	for (int j = 0; j < nVars; ++j)
+		x[ j ] = 0.5 + 0.25 * j;
+	BOOST_REQUIRE( f.evaluate(0, &x[ 0 ], &result[ 0 ]) == SUCCESSFUL_RETURN );
+
+	vector< double > seed(nVars * nDirs, 0.0), df(3 * nDirs), seed1( nVars ), df1( 3 );
+	for (int j = 0; j < nVars; ++j)
+		for (int k = 0; k < nDirs; ++k)
+			seed[j * nDirs + k] = 1.0 + j - 2.0 * k;
+
+	vector< double > seedCopy( seed );
+	BOOST_REQUIRE( f.AD_forward(0, nDirs, &seedCopy[ 0 ], &df[ 0 ]) == SUCCESSFUL_RETURN );
+
+	for (int k = 0; k < nDirs; ++k)
+	{
+		for (int j = 0; j < nVars; ++j)
+			seed1[ j ] = seed[j * nDirs + k];
+		BOOST_REQUIRE( f.AD_forward(0, &seed1[ 0 ], &df1[ 0 ]) == SUCCESSFUL_RETURN );
+
+		for (int i = 0; i < 3; ++i)
+			BOOST_REQUIRE( acadoIsEqual(df[i * nDirs + k], df1[ i ]) );
+	}
+
+	vector< double > bseed(3 * nDirs), G(nVars * nDirs, 0.0), bseed1( 3 ), G1( nVars );
+	for (int i = 0; i < 3; ++i)
+		for (int k = 0; k < nDirs; ++k)
+			bseed[i * nDirs + k] = 0.5 * i - k;
+
+	BOOST_REQUIRE( f.AD_backward(0, nDirs, &bseed[ 0 ], &G[ 0 ]) == SUCCESSFUL_RETURN );
+
+	for (int k = 0; k < nDirs; ++k)
+	{
+		for (int i = 0; i < 3; ++i)
+			bseed1[ i ] = bseed[i * nDirs + k];
+		fill(G1.begin(), G1.end(), 0.0);
+		BOOST_REQUIRE( f.AD_backward(0, &bseed1[ 0 ], &G1[ 0 ]) == SUCCESSFUL_RETURN );
+
+		for (int j = 0; j < nVars; ++j)
+			BOOST_REQUIRE( acadoIsEqual(G[j * nDirs + k], G1[ j ]) );
+	}
+}
+
+static int nCalls = 0;
+
+static void chain( double* x, double* f, void* )
+{
+	for (int i = 0; i < 4; ++i)
+		f[ i ] = x[ i ] * x[ i ] + ( i < 3 ? sin( x[i + 1] ) : 0.0 );
+	++nCalls;
+}
+
+static void chainBatch( int nPoints, double* x, double* f, void* )
+{
+	for (int k = 0; k < nPoints; ++k)
+	{
+		chain(x + 4 * k, f + 4 * k, 0);
+		--nCalls;
+	}
+	++nCalls;
+}
+
+BOOST_AUTO_TEST_CASE( c_function_colored_finite_differences )
+{
+	DifferentialState x("", 4, 1);
+
+	BMatrix pattern(4, 4);
+	pattern.setAll( false );
+	for (int i = 0; i < 4; ++i)
+	{
+		pattern(i, i) = true;
+		if (i < 3)
+			pattern(i, i + 1) = true;
+	}
+
+	CFunction cFcn(4, chain);
+	BOOST_REQUIRE( cFcn.setSparsityPattern( pattern ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( cFcn.setBatchEvaluation( chainBatch ) == SUCCESSFUL_RETURN );
+
+	Function f;
+	f << cFcn( x );
+
+	const int nVars = f.getNumberOfVariables() + 1;
+	vector< double > xx(nVars, 0.0), result( 4 ), seed( nVars ), df( 4 );
+	for (int j = 0; j < 4; ++j)
+		xx[f.index(VT_DIFFERENTIAL_STATE, x.getComponent( j ))] = 0.3 * (j + 1);
+	BOOST_REQUIRE( f.evaluate(0, &xx[ 0 ], &result[ 0 ]) == SUCCESSFUL_RETURN );
+
+	// The first direction is a directional difference with two evaluations,
+	// the tridiagonal Jacobian is then obtained by one batch call with three points
+	nCalls = 0;
+	for (int j = 0; j < 4; ++j)
+	{
+		fill(seed.begin(), seed.end(), 0.0);
+		seed[f.index(VT_DIFFERENTIAL_STATE, x.getComponent( j ))] = 1.0;
+		BOOST_REQUIRE( f.AD_forward(0, &seed[ 0 ], &df[ 0 ]) == SUCCESSFUL_RETURN );
+
+		for (int i = 0; i < 4; ++i)
+		{
+			double exact = 0.0;
+			if (i == j)
+				exact = 2.0 * 0.3 * (j + 1);
+			if (i + 1 == j)
+				exact = cos(0.3 * (j + 1));
+			BOOST_REQUIRE( fabs(df[ i ] - exact) < 1e-6 );
+		}
+
+		if (j == 0)
+			BOOST_REQUIRE_EQUAL(nCalls, 2);
+	}
+	BOOST_REQUIRE_EQUAL(nCalls, 3);
+}
+
+BOOST_AUTO_TEST_CASE( affine_components_are_detected )
+{
+	DifferentialState x1, x2;
+	Control u;
+
+	Function f;
+	f << 2.0 * x1 - x2 + 3.0 * u;
+	f << x1 * x2;
+	f << 4.0;
+	f << exp( x1 ) + u;
+
+	BOOST_REQUIRE( f.isAffine( 0 ) == BT_TRUE );
+	BOOST_REQUIRE( f.isAffine( 1 ) == BT_FALSE );
+	BOOST_REQUIRE( f.isAffine( 2 ) == BT_TRUE );
+	BOOST_REQUIRE( f.isAffine( 3 ) == BT_FALSE );
+	BOOST_REQUIRE( f.isAffine( 4 ) == BT_FALSE );
+}
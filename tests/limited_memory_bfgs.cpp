@@ -0,0 +1,143 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE LimitedMemoryBFGSTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp>
+
+#include <deque>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Gives access to the update of the full matrix. */
+class TestUpdate : public LimitedMemoryBFGSupdate
+{
+public:
+	TestUpdate( uint _memorySize ) : LimitedMemoryBFGSupdate( 0,0,_memorySize )
+	{
+		setBFGSModification( MOD_NO_MODIFICATION );
+	}
+
+	returnValue update( BlockMatrix& B, const BlockMatrix& x, const BlockMatrix& y )
+	{
+		return applyUpdate(B, x, y);
+	}
+};
+
+static const uint dims[ 2 ] = {3, 1};
+static const uint n = 4;
+
+/** Splits a vector into the two components used by the update. */
+static BlockMatrix toBlocks( const DVector& v )
+{
+	BlockMatrix result(2, 1);
+	result.setDense(0, 0, v.segment(0, dims[ 0 ]));
+	result.setDense(1, 0, v.segment(dims[ 0 ], dims[ 1 ]));
+
+	return result;
+}
+
+static DMatrix toDense( const BlockMatrix& B )
+{
+	DMatrix result(n, n), tmp;
+
+	for (uint i = 0; i < 2; ++i)
+		for (uint j = 0; j < 2; ++j)
+		{
+			B.getSubBlock(i, j, tmp);
+			BOOST_REQUIRE_EQUAL(tmp.getNumRows(), dims[ i ]);
+			BOOST_REQUIRE_EQUAL(tmp.getNumCols(), dims[ j ]);
+			result.block(i == 0 ? 0 : dims[ 0 ], j == 0 ? 0 : dims[ 0 ], dims[ i ], dims[ j ]) = tmp;
+		}
+
+	return result;
+}
+
+/** Dense BFGS update of delta*I by all given pairs, in order. */
+static DMatrix denseBFGS( const deque< DVector >& S, const deque< DVector >& Y )
+{
+	const DVector& s = S.back();
+	const DVector& y = Y.back();
+
+	DMatrix B(n, n);
+	B.setIdentity();
+	B *= y.dot( y ) / s.dot( y );
+
+	for (uint k = 0; k < S.size(); ++k)
+	{
+		DVector Bs = B * S[ k ];
+		B += Y[ k ] * Y[ k ].transpose() / S[ k ].dot( Y[ k ] ) - Bs * Bs.transpose() / S[ k ].dot( Bs );
+	}
+
+	return B;
+}
+
+BOOST_AUTO_TEST_CASE( compact_representation_matches_dense_update )
+{
+	const uint memorySize = 3;
+	const uint nPairs = 7;
+
+	// Hessian of a small convex quadratic
+	DMatrix A(n, n);
+	A << 4.0, 1.0, 0.0, 0.5,
+		 1.0, 3.0, 0.2, 0.0,
+		 0.0, 0.2, 2.0, 0.3,
+		 0.5, 0.0, 0.3, 1.5;
+
+	TestUpdate update( memorySize );
+
+	BlockMatrix B(2, 2);
+	for (uint i = 0; i < 2; ++i)
+		for (uint j = 0; j < 2; ++j)
+		{
+			DMatrix tmp(dims[ i ], dims[ j ]);
+			tmp.setZero();
+			if (i == j)
+				tmp.setIdentity();
+			B.setDense(i, j, tmp);
+		}
+
+	deque< DVector > S, Y;
+
+	for (uint k = 0; k < nPairs; ++k)
+	{
+		DVector s( n );
+		for (uint i = 0; i < n; ++i)
+			s( i ) = sin(1.0 + 3.0 * k + 1.7 * i) + (i == k % n ? 1.0 : 0.0);
+		DVector y = A * s;
+
+		BOOST_REQUIRE( update.update(B, toBlocks( s ), toBlocks( y )) == SUCCESSFUL_RETURN );
+
+		// only the last memorySize pairs enter the compact representation
+		S.push_back( s );
+		Y.push_back( y );
+		if (S.size() > memorySize)
+		{
+			S.pop_front();
+			Y.pop_front();
+		}
+
+		DMatrix Bk = toDense( B );
+		DMatrix reference = denseBFGS(S, Y);
+
+		for (uint j = 0; j < n; ++j)
+		{
+			DVector v( n );
+			for (uint i = 0; i < n; ++i)
+				v( i ) = cos(0.5 * i + 2.0 * j);
+
+			DVector Bv = Bk * v;
+			DVector refBv = reference * v;
+			for (uint i = 0; i < n; ++i)
+				BOOST_REQUIRE_SMALL(Bv( i ) - refBv( i ), 1e-10 * (1.0 + fabs(refBv( i ))));
+		}
+
+		// the update satisfies the secant equation for the latest pair
+		DVector Bs = Bk * s;
+		for (uint i = 0; i < n; ++i)
+			BOOST_REQUIRE_SMALL(Bs( i ) - y( i ), 1e-10 * (1.0 + fabs(y( i ))));
+	}
+}
@@ -24,3 +24,31 @@ BOOST_AUTO_TEST_CASE( vector_ctors )
     BOOST_REQUIRE( d.getDim() == 2 );
     BOOST_REQUIRE( acadoIsEqual(d( 0 ), -10) && acadoIsEqual(d( 1 ), 99) );
 }
+
+BOOST_AUTO_TEST_CASE( tmatrix_storage )
+{
+	Tmatrix< double > a(3, 3), b;
+	for (unsigned i = 0; i < 9; ++i)
+		a( i ) = i;
+
+	// Rows and columns refer to the elements of the matrix
+	a.row( 1 ) = -1.0;
+	a.col( 2 ) = Tmatrix< double >(3, 1, 5.0);
+
+	BOOST_REQUIRE( acadoIsEqual(a(1, 0), -1) && acadoIsEqual(a(1, 1), -1) );
+	BOOST_REQUIRE( acadoIsEqual(a(0, 2), 5) && acadoIsEqual(a(1, 2), 5) );
+	BOOST_REQUIRE( acadoIsEqual(a(2, 1), 5) );
+
+	Tmatrix< double > r = a.row( 2 );
+	BOOST_REQUIRE( r.getNumRows() == 1 && r.getNumCols() == 3 );
+	BOOST_REQUIRE( acadoIsEqual(r( 0 ), 2) && acadoIsEqual(r( 2 ), 5) );
+
+	// Copies are deep, for small and for large matrices
+	Tmatrix< double > c( a ), s(2, 1, 1.0), t( s );
+	c( 0 ) = 42; t( 0 ) = 42;
+	BOOST_REQUIRE( acadoIsEqual(a( 0 ), 0) && acadoIsEqual(s( 0 ), 1) );
+
+	b = -a;
+	BOOST_REQUIRE( b.getDim() == 9 && acadoIsEqual(b(2, 2), -5) );
+	BOOST_REQUIRE( acadoIsEqual(a.data()[ 7 ], 5) );
+}
@@ -0,0 +1,69 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE MultiObjectiveAlgorithmTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_optimal_control.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Computes the Pareto front of the scalar2_nnc example. */
+static void computeParetoFront( int numThreads, VariablesGrid& paretoFront )
+{
+	// the parameters of each run are numbered from zero
+	clearAllStaticCounters( );
+
+	Parameter y1, y2;
+
+	NLP nlp;
+	nlp.minimize( 0, y1 );
+	nlp.minimize( 1, y2 );
+
+	nlp.subjectTo( 0.0 <= y1 <= 5.0 );
+	nlp.subjectTo( 0.0 <= y2 <= 5.2 );
+	nlp.subjectTo( 0.0 <= y2 - 5.0*exp(-y1) - 2.0*exp(-0.5*(y1-3.0)*(y1-3.0)) );
+
+	DMatrix init(1, 3);
+	init(0, 0) = 0.0;
+	init(0, 1) = 5.0;
+	init(0, 2) = 0.30436030146863158;
+
+	MultiObjectiveAlgorithm algorithm( nlp );
+
+	algorithm.set( PARETO_FRONT_GENERATION, PFG_NORMALIZED_NORMAL_CONSTRAINT );
+	algorithm.set( PARETO_FRONT_DISCRETIZATION, 9 );
+	algorithm.set( PARETO_FRONT_NUM_THREADS, numThreads );
+	algorithm.set( KKT_TOLERANCE, 1e-12 );
+	algorithm.set( PRINTLEVEL, NONE );
+
+	algorithm.initializeParameters( VariablesGrid( init ) );
+	BOOST_REQUIRE( algorithm.solveSingleObjective( 1 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( algorithm.solveSingleObjective( 0 ) == SUCCESSFUL_RETURN );
+
+	algorithm.initializeParameters( VariablesGrid( init ) );
+	BOOST_REQUIRE( algorithm.solve( ) == SUCCESSFUL_RETURN );
+
+	BOOST_REQUIRE( algorithm.getParetoFront( paretoFront ) == SUCCESSFUL_RETURN );
+}
+
+BOOST_AUTO_TEST_CASE( parallel_pareto_front_matches_serial )
+{
+	VariablesGrid serialFront, parallelFront;
+
+	computeParetoFront(1, serialFront);
+	computeParetoFront(3, parallelFront);
+
+	BOOST_REQUIRE_EQUAL(serialFront.getNumPoints(), 9u);
+	BOOST_REQUIRE_EQUAL(parallelFront.getNumPoints(), serialFront.getNumPoints());
+	BOOST_REQUIRE_EQUAL(parallelFront.getNumValues(), serialFront.getNumValues());
+
+	for (unsigned i = 0; i < serialFront.getNumPoints(); ++i)
+	{
+		BOOST_REQUIRE_SMALL(parallelFront.getTime( i ) - serialFront.getTime( i ), 1e-8);
+		for (unsigned j = 0; j < serialFront.getNumValues(); ++j)
+			BOOST_REQUIRE_SMALL(parallelFront(i, j) - serialFront(i, j), 1e-8);
+	}
+}
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE NoiseTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/noise/noise.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+BOOST_AUTO_TEST_CASE( gaussian_noise_reproducible )
+{
+	GaussianNoise a( 2,0.0,1.0 ), b( 2,0.0,1.0 );
+	VariablesGrid wa( 2,10 ), wb( 2,10 );
+
+	BOOST_REQUIRE( a.init( 42 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( b.init( 42 ) == SUCCESSFUL_RETURN );
+
+	a.step( wa );
+	b.step( wb );
+
+	for (unsigned i = 0; i < 10; ++i)
+		for (unsigned j = 0; j < 2; ++j)
+			BOOST_REQUIRE( acadoIsEqual(wa(i, j), wb(i, j)) );
+
+	// Different streams generate different noise
+	b.setStreamId( 1 );
+	b.init( 42 );
+	b.step( wb );
+
+	BOOST_REQUIRE( acadoIsEqual(wa(0, 0), wb(0, 0)) == BT_FALSE );
+}
+
+BOOST_AUTO_TEST_CASE( gaussian_noise_bulk_equals_pointwise )
+{
+	GaussianNoise bulk( 3,1.0,4.0 ), pointwise( 3,1.0,4.0 );
+	VariablesGrid w( 3,7 );
+	DVector v( 3 );
+
+	bulk.init( 7 );
+	pointwise.init( 7 );
+
+	// Start at an odd position of the stream
+	bulk.step( v );
+	pointwise.step( v );
+
+	bulk.step( w );
+	for (unsigned i = 0; i < 7; ++i)
+	{
+		pointwise.step( v );
+		for (unsigned j = 0; j < 3; ++j)
+			BOOST_REQUIRE( acadoIsEqual(w(i, j), v( j )) );
+	}
+
+	// A clone of a single component generates the same values as the full noise
+	GaussianNoise full( 3,1.0,4.0 );
+	GaussianNoise* component = full.clone( 2 );
+	VariablesGrid wFull( 3,5 ), wComponent( 1,5 );
+
+	full.init( 11 );
+	component->init( 11 );
+	full.step( wFull );
+	component->step( wComponent );
+
+	for (unsigned i = 0; i < 5; ++i)
+		BOOST_REQUIRE( acadoIsEqual(wFull(i, 2), wComponent(i, 0)) );
+
+	delete component;
+}
+
+BOOST_AUTO_TEST_CASE( noise_statistics )
+{
+	const unsigned n = 20000;
+
+	GaussianNoise gaussian( 1,2.0,9.0 );
+	UniformNoise uniform( 1,-1.0,3.0 );
+	VariablesGrid wg( 1,n ), wu( 1,n );
+
+	gaussian.init( 3 );
+	uniform.init( 3 );
+	gaussian.step( wg );
+	uniform.step( wu );
+
+	double meanG = 0.0, meanU = 0.0;
+	for (unsigned i = 0; i < n; ++i)
+	{
+		meanG += wg(i, 0) / n;
+		meanU += wu(i, 0) / n;
+
+		BOOST_REQUIRE( wu(i, 0) >= -1.0 && wu(i, 0) < 3.0 );
+	}
+
+	double varG = 0.0;
+	for (unsigned i = 0; i < n; ++i)
+		varG += (wg(i, 0) - meanG) * (wg(i, 0) - meanG) / (n - 1);
+
+	BOOST_CHECK_CLOSE( meanG, 2.0, 5.0 );
+	BOOST_CHECK_CLOSE( varG, 9.0, 5.0 );
+	BOOST_CHECK_CLOSE( meanU, 1.0, 5.0 );
+}
@@ -0,0 +1,72 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE OptionsListTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/user_interaction/options_list.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+BOOST_AUTO_TEST_CASE( revision_counts_modifications )
+{
+	OptionsList list;
+	int iValue;
+	double dValue;
+
+	BOOST_REQUIRE_EQUAL(list.getRevision(), 0u);
+
+	// Defining new options is not a modification
+	BOOST_REQUIRE( list.add(MAX_NUM_ITERATIONS, 100) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( list.add(KKT_TOLERANCE, 1e-6) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(list.getNumber(), 2u);
+	BOOST_REQUIRE_EQUAL(list.getRevision(), 0u);
+	BOOST_REQUIRE( list.haveOptionsChanged() == BT_FALSE );
+
+	BOOST_REQUIRE( list.set(MAX_NUM_ITERATIONS, 50) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(list.getRevision(), 1u);
+	BOOST_REQUIRE( list.haveOptionsChanged() == BT_TRUE );
+	BOOST_REQUIRE( list.get(MAX_NUM_ITERATIONS, iValue) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(iValue, 50);
+
+	// Re-adding an existing option overwrites it and is a modification
+	BOOST_REQUIRE( list.declareOptionsUnchanged() == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( list.haveOptionsChanged() == BT_FALSE );
+	BOOST_REQUIRE( list.add(KKT_TOLERANCE, 1e-8) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(list.getNumber(), 2u);
+	BOOST_REQUIRE_EQUAL(list.getRevision(), 2u);
+	BOOST_REQUIRE( list.haveOptionsChanged() == BT_TRUE );
+	BOOST_REQUIRE( list.get(KKT_TOLERANCE, dValue) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( acadoIsEqual(dValue, 1e-8) );
+
+	// Options of different types are kept apart
+	BOOST_REQUIRE( list.hasOption(MAX_NUM_ITERATIONS, OIT_INT) == BT_TRUE );
+	BOOST_REQUIRE( list.hasOption(MAX_NUM_ITERATIONS, OIT_DOUBLE) == BT_FALSE );
+}
+
+BOOST_AUTO_TEST_CASE( assignment_increases_revision )
+{
+	OptionsList a, b;
+
+	a.add(MAX_NUM_ITERATIONS, 10);
+	a.set(MAX_NUM_ITERATIONS, 20);
+	a.set(MAX_NUM_ITERATIONS, 30);
+
+	b.add(MAX_NUM_ITERATIONS, 10);
+	b.set(MAX_NUM_ITERATIONS, 40);
+
+	// The revision never decreases, even if the source has seen fewer changes
+	const uint oldRevision = a.getRevision();
+	a = b;
+	BOOST_REQUIRE( a.getRevision() > oldRevision );
+
+	int value;
+	BOOST_REQUIRE( a.get(MAX_NUM_ITERATIONS, value) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(value, 40);
+
+	// Copies start from the revision of their source
+	OptionsList c( a );
+	BOOST_REQUIRE_EQUAL(c.getRevision(), a.getRevision());
+}
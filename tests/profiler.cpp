@@ -0,0 +1,99 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE ProfilerTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/clock/profiler.hpp>
+
+#include <sstream>
+#include <thread>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+static void inner( )
+{
+	ACADO_PROFILE( "inner" );
+}
+
+static void outer( uint nInner )
+{
+	ACADO_PROFILE( "outer" );
+
+	for (uint i = 0; i < nInner; ++i)
+		inner( );
+}
+
+BOOST_AUTO_TEST_CASE( sections_are_counted_when_enabled )
+{
+	double time;
+	uint numCalls;
+
+	Profiler::reset( );
+	BOOST_REQUIRE( Profiler::isEnabled() == BT_FALSE );
+
+	// Nothing is recorded while the profiler is disabled
+	outer( 2 );
+	BOOST_REQUIRE( Profiler::getSectionTime("outer", time, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 0u);
+
+	Profiler::enable( );
+	BOOST_REQUIRE( Profiler::isEnabled() == BT_TRUE );
+
+	outer( 3 );
+	outer( 2 );
+	inner( );
+
+	BOOST_REQUIRE( Profiler::getSectionTime("outer", time, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 2u);
+
+	// Calls are summed over the call paths outer;inner and inner
+	double innerTime;
+	BOOST_REQUIRE( Profiler::getSectionTime("inner", innerTime, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 6u);
+	BOOST_REQUIRE( innerTime >= 0.0 );
+
+	stringstream folded;
+	BOOST_REQUIRE( Profiler::printFoldedStacks( folded ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( folded.str().find( "outer" ) != string::npos );
+
+	// Recorded data is kept when disabling, but no new calls are added
+	Profiler::disable( );
+	outer( 1 );
+	BOOST_REQUIRE( Profiler::getSectionTime("outer", time, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 2u);
+
+	Profiler::reset( );
+	BOOST_REQUIRE( Profiler::getSectionTime("outer", time, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 0u);
+}
+
+BOOST_AUTO_TEST_CASE( threads_record_separate_trees )
+{
+	double time;
+	uint numCalls, workerCalls = 0;
+
+	Profiler::reset( );
+	Profiler::enable( );
+
+	outer( 1 );
+
+	// The enabled flag is shared, the recorded tree is not
+	thread worker([&workerCalls]( )
+	{
+		double workerTime;
+		outer( 4 );
+		Profiler::getSectionTime("inner", workerTime, workerCalls);
+	});
+	worker.join( );
+
+	Profiler::disable( );
+
+	BOOST_REQUIRE_EQUAL(workerCalls, 4u);
+	BOOST_REQUIRE( Profiler::getSectionTime("inner", time, numCalls) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(numCalls, 1u);
+
+	Profiler::reset( );
+}
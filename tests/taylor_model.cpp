@@ -0,0 +1,137 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE TaylorModelTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/set_arithmetics/set_arithmetics.hpp>
+
+#include <utility>
+#include <vector>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+typedef TaylorModel<Interval> TM;
+typedef TaylorVariable<Interval> TV;
+
+static void requireEqual( const TV& a, const TV& b )
+{
+	BOOST_REQUIRE( a.env() == b.env() );
+	BOOST_REQUIRE_EQUAL(a.constant(), b.constant());
+	BOOST_REQUIRE_EQUAL(a.B().l(), b.B().l());
+	BOOST_REQUIRE_EQUAL(a.B().u(), b.B().u());
+	BOOST_REQUIRE_EQUAL(a.R().l(), b.R().l());
+	BOOST_REQUIRE_EQUAL(a.R().u(), b.R().u());
+
+	const double x[ 2 ] = {0.7, -0.1};
+	BOOST_REQUIRE_EQUAL(a.P( x ), b.P( x ));
+}
+
+static void requireZeroScalar( const TV& a )
+{
+	BOOST_REQUIRE( a.env() == 0 );
+	BOOST_REQUIRE_EQUAL(a.constant(), 0.0);
+	BOOST_REQUIRE_EQUAL(a.B().l(), 0.0);
+	BOOST_REQUIRE_EQUAL(a.B().u(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE( move_leaves_zero_scalar )
+{
+	TM model( 2,3 );
+
+	TV X( &model,0,Interval( 0.5,1.0 ) );
+	TV Y( &model,1,Interval( -0.2,0.2 ) );
+
+	TV Z = exp( X ) * Y + sqr( X );
+	const TV reference( Z );
+
+	// Move construction takes over the coefficients
+	TV moved( std::move( Z ) );
+	requireEqual(moved, reference);
+	requireZeroScalar( Z );
+
+	// Move assignment into a variable linked to the same model
+	TV target( X );
+	target = std::move( moved );
+	requireEqual(target, reference);
+	requireZeroScalar( moved );
+
+	// Moved-from variables can be reused
+	moved = target;
+	requireEqual(moved, reference);
+	Z = 3.0;
+	BOOST_REQUIRE( Z.env() == 0 );
+	BOOST_REQUIRE_EQUAL(Z.constant(), 3.0);
+
+	// Moving a variable that is not linked to a model copies it
+	TV scalar( 2.0 );
+	TV scalarCopy( std::move( scalar ) );
+	BOOST_REQUIRE( scalarCopy.env() == 0 );
+	BOOST_REQUIRE_EQUAL(scalarCopy.constant(), 2.0);
+	BOOST_REQUIRE_EQUAL(scalar.constant(), 2.0);
+}
+
+BOOST_AUTO_TEST_CASE( temporaries_match_copies )
+{
+	TM model( 2,4 );
+
+	TV X( &model,0,Interval( 0.5,1.0 ) );
+	TV Y( &model,1,Interval( -0.2,0.2 ) );
+
+	// Rvalue operators reuse the storage of temporaries
+	TV fromTemporaries = ( X + Y ) * 2.0 - ( X * Y ) + sin( Y ) * 0.5;
+
+	TV sum( X ); sum += Y;
+	TV scaledSum( sum ); scaledSum *= 2.0;
+	TV product( X ); product *= Y;
+	TV sine( sin( Y ) ); sine *= 0.5;
+	TV fromCopies( scaledSum ); fromCopies -= product; fromCopies += sine;
+
+	requireEqual(fromTemporaries, fromCopies);
+}
+
+BOOST_AUTO_TEST_CASE( released_storage_is_reused )
+{
+	TM model( 2,3 );
+
+	TV X( &model,0,Interval( 0.5,1.0 ) );
+	TV Y( &model,1,Interval( -0.2,0.2 ) );
+	const TV reference = log( X ) + X * Y;
+
+	// Blocks handed back to the arena are recycled for later variables,
+	// which must not see the coefficients of their predecessors
+	for (unsigned k = 0; k < 3; ++k)
+	{
+		vector< TV > variables;
+		for (unsigned i = 0; i < 50; ++i)
+			variables.push_back( X * ( 1.0 + i ) + Y );
+
+		for (unsigned i = 0; i < variables.size(); ++i)
+			BOOST_REQUIRE_CLOSE(variables[ i ].constant(), 0.75 * ( 1.0 + i ), 1e-12);
+
+		TV fresh = log( X ) + X * Y;
+		requireEqual(fresh, reference);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( variables_outlive_model )
+{
+	TM* model = new TM( 2,3 );
+
+	TV X( model,0,Interval( 0.5,1.0 ) );
+	TV Y( model,1,Interval( -0.2,0.2 ) );
+	TV Z = X * Y;
+	TV W( Z );
+
+	// The arena stays alive until the last variable returns its storage
+	delete model;
+
+	W = 1.0;
+	BOOST_REQUIRE( W.env() == 0 );
+	BOOST_REQUIRE_EQUAL(W.constant(), 1.0);
+
+	TV V( std::move( W ) );
+	BOOST_REQUIRE_EQUAL(V.constant(), 1.0);
+}
@@ -0,0 +1,157 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE VariablesGridTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/variables_grid/variables_grid_view.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+static VariablesGrid referenceGrid( )
+{
+	VariablesGrid grid( 3,Grid( 0.0,2.0,5 ) );
+
+	for (unsigned i = 0; i < grid.getNumPoints(); ++i)
+		for (unsigned j = 0; j < grid.getNumValues(); ++j)
+			grid(i, j) = 10.0 * i + j;
+
+	return grid;
+}
+
+static void requireEqual( const VariablesGrid& a, const VariablesGrid& b )
+{
+	BOOST_REQUIRE_EQUAL(a.getNumPoints(), b.getNumPoints());
+	BOOST_REQUIRE_EQUAL(a.getNumValues(), b.getNumValues());
+
+	for (unsigned i = 0; i < a.getNumPoints(); ++i)
+	{
+		BOOST_REQUIRE( acadoIsEqual(a.getTime( i ), b.getTime( i )) );
+		for (unsigned j = 0; j < a.getNumValues(); ++j)
+			BOOST_REQUIRE( acadoIsEqual(a(i, j), b(i, j)) );
+	}
+}
+
+BOOST_AUTO_TEST_CASE( view_matches_sub_grid )
+{
+	VariablesGrid grid = referenceGrid( );
+
+	const double windows[][ 2 ] = {
+		{0.0, 2.0}, {0.5, 1.5}, {0.2, 1.3}, {0.6, 0.9}, {1.0, 1.0}, {0.0, 0.3}
+	};
+
+	for (unsigned k = 0; k < sizeof( windows ) / sizeof( windows[ 0 ] ); ++k)
+	{
+		VariablesGridView view( grid,windows[ k ][ 0 ],windows[ k ][ 1 ] );
+		requireEqual(VariablesGrid( view ), grid.getTimeSubGrid(windows[ k ][ 0 ], windows[ k ][ 1 ]));
+
+		view.selectValues(1, 2);
+		requireEqual(VariablesGrid( view ),
+				grid.getTimeSubGrid(windows[ k ][ 0 ], windows[ k ][ 1 ]).getValuesSubGrid(1, 2));
+	}
+}
+
+BOOST_AUTO_TEST_CASE( view_assignment_reuses_memory )
+{
+	VariablesGrid grid = referenceGrid( );
+	VariablesGrid window;
+
+	window = VariablesGridView( grid,0.2,0.7 );
+	double* storage = &window(0, 0);
+
+	window = VariablesGridView( grid,1.2,1.7 );
+	BOOST_REQUIRE( &window(0, 0) == storage );
+	requireEqual(window, grid.getTimeSubGrid(1.2, 1.7));
+
+	// Constant extrapolation beyond the last grid point
+	window = VariablesGridView( grid,1.8,2.5,BT_TRUE );
+	BOOST_REQUIRE_EQUAL(window.getNumPoints(), 2u);
+	BOOST_REQUIRE( acadoIsEqual(window.getLastTime(), 2.5) );
+	BOOST_REQUIRE( acadoIsEqual(window(1, 2), grid(4, 2)) );
+
+	window = VariablesGridView( grid,3.0,4.0,BT_TRUE );
+	BOOST_REQUIRE_EQUAL(window.getNumPoints(), 2u);
+	BOOST_REQUIRE( acadoIsEqual(window.getFirstTime(), 3.0) );
+	BOOST_REQUIRE( acadoIsEqual(window(0, 1), grid(4, 1)) );
+}
+
+BOOST_AUTO_TEST_CASE( contiguous_storage_maps )
+{
+	MatrixVariablesGrid grid;
+
+	for (unsigned i = 0; i < 20; ++i)
+	{
+		DMatrix m(2, 3);
+		for (unsigned r = 0; r < 2; ++r)
+			for (unsigned c = 0; c < 3; ++c)
+				m(r, c) = 100.0 * i + 10.0 * r + c;
+
+		BOOST_REQUIRE( grid.addMatrix(m, (double)i) == SUCCESSFUL_RETURN );
+	}
+	BOOST_REQUIRE_EQUAL(grid.getDim(), 20u * 6u);
+
+	const MatrixVariablesGrid& cgrid = grid;
+	for (unsigned i = 0; i < 20; ++i)
+		BOOST_REQUIRE( acadoIsEqual(cgrid.getMatrixMap( i )(1, 2), grid(i, 1, 2)) );
+
+	grid.getComponentMap(1, 2).setConstant( -1.0 );
+	for (unsigned i = 0; i < 20; ++i)
+	{
+		BOOST_REQUIRE( acadoIsEqual(grid(i, 1, 2), -1.0) );
+		BOOST_REQUIRE( acadoIsEqual(grid(i, 0, 2), 100.0 * i + 2.0) );
+	}
+	BOOST_REQUIRE( acadoIsEqual(cgrid.getComponentMap(0, 1).sum(), 100.0 * 190 + 20.0) );
+
+	// Bounds are kept per grid point
+	VariablesGrid x( 2,Grid( 0.0,1.0,3 ) );
+	x.setLowerBound(1, 0, -5.0);
+	VariablesGrid y( x );
+	y.appendValues( x );
+	BOOST_REQUIRE_EQUAL(y.getNumValues(), 4u);
+	BOOST_REQUIRE( acadoIsEqual(y.getLowerBound(1, 2), -5.0) );
+	BOOST_REQUIRE( acadoIsEqual(y.getLowerBound(2, 2), -INFTY) );
+}
+
+BOOST_AUTO_TEST_CASE( hinted_lookups_match_binary_search )
+{
+	const double times[] = {0.0, 0.1, 0.1, 0.25, 0.5, 0.5, 0.5, 0.8, 1.0, 1.3};
+	Grid grid( sizeof( times ) / sizeof( times[ 0 ] ),(double*)times );
+
+	uint floorHint = 0, ceilHint = 0, timeHint = 0;
+
+	// sequential lookups at increasing times followed by a jump back
+	for (unsigned k = 0; k < 2 * 151; ++k)
+	{
+		double t = -0.1 + 0.01 * (k % 151);
+		BOOST_REQUIRE_EQUAL(grid.getFloorIndex(t, floorHint), grid.getFloorIndex( t ));
+		BOOST_REQUIRE_EQUAL(grid.getCeilIndex(t, ceilHint), grid.getCeilIndex( t ));
+		BOOST_REQUIRE_EQUAL(grid.hasTime(t, timeHint), grid.hasTime( t ));
+	}
+
+	// interpolation keeps the hint at the floor index
+	VariablesGrid values( 2,grid );
+	for (unsigned i = 0; i < values.getNumPoints(); ++i)
+	{
+		values(i, 0) = i;
+		values(i, 1) = times[ i ] * times[ i ];
+	}
+
+	uint interpolationHint = 0;
+	for (unsigned k = 0; k < 2 * 151; ++k)
+	{
+		double t = -0.1 + 0.01 * (k % 151);
+		DVector hinted = values.linearInterpolation(t, interpolationHint);
+		DVector reference = values.linearInterpolation( t );
+
+		BOOST_REQUIRE_EQUAL(interpolationHint, grid.getFloorIndex( t ));
+		BOOST_REQUIRE( acadoIsEqual(hinted(0), reference(0)) );
+		BOOST_REQUIRE( acadoIsEqual(hinted(1), reference(1)) );
+	}
+
+	Grid subGrid;
+	grid.getSubGrid(0.1, 0.6, subGrid);
+	BOOST_REQUIRE_EQUAL(subGrid.getNumPoints(), 7u);
+	BOOST_REQUIRE( acadoIsEqual(subGrid.getLastTime(), 0.6) );
+}
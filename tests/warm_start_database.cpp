@@ -0,0 +1,136 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE WarmStartDatabaseTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/optimization_algorithm/warm_start_database.hpp>
+
+#include <cstdio>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+static DVector makeKey( double k0, double k1 )
+{
+	DVector key( 2 );
+	key( 0 ) = k0;
+	key( 1 ) = k1;
+
+	return key;
+}
+
+static OCPiterate makeIterate( double offset )
+{
+	VariablesGrid x( 2,Grid( 0.0,1.0,3 ) );
+	VariablesGrid u( 1,Grid( 0.0,1.0,3 ) );
+
+	for (unsigned i = 0; i < x.getNumPoints(); ++i)
+	{
+		for (unsigned j = 0; j < x.getNumValues(); ++j)
+			x(i, j) = offset + 10.0 * i + j;
+		u(i, 0) = -offset - i;
+	}
+
+	// a grid with points but without any values
+	VariablesGrid p( 0,Grid( 0.0,1.0,3 ) );
+
+	return OCPiterate( &x,0,&p,&u,0 );
+}
+
+static void requireEqual( const VariablesGrid* const a, const VariablesGrid* const b )
+{
+	BOOST_REQUIRE_EQUAL(a == 0, b == 0);
+	if (a == 0)
+		return;
+
+	BOOST_REQUIRE_EQUAL(a->getNumPoints(), b->getNumPoints());
+	BOOST_REQUIRE_EQUAL(a->getNumValues(), b->getNumValues());
+
+	for (unsigned i = 0; i < a->getNumPoints(); ++i)
+	{
+		BOOST_REQUIRE( acadoIsEqual(a->getTime( i ), b->getTime( i )) );
+		for (unsigned j = 0; j < a->getNumValues(); ++j)
+			BOOST_REQUIRE( acadoIsEqual((*a)(i, j), (*b)(i, j)) );
+	}
+}
+
+BOOST_AUTO_TEST_CASE( nearest_neighbour_lookup )
+{
+	WarmStartDatabase database;
+	OCPiterate iterate;
+	double distance;
+
+	BOOST_REQUIRE( database.getNearest(makeKey(0.0, 0.0), iterate) == RET_INVALID_ARGUMENTS );
+
+	BOOST_REQUIRE( database.add(makeKey(0.0, 0.0), makeIterate( 0.0 )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( database.add(makeKey(1.0, 0.0), makeIterate( 1.0 )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( database.add(makeKey(0.0, 4.0), makeIterate( 2.0 )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(database.getNumEntries(), 3u);
+	BOOST_REQUIRE_EQUAL(database.getKeyDim(), 2u);
+
+	BOOST_REQUIRE( database.getNearest(makeKey(0.8, 1.0), iterate, &distance) == SUCCESSFUL_RETURN );
+	requireEqual(iterate.x, makeIterate( 1.0 ).x);
+	BOOST_REQUIRE( acadoIsEqual(distance, sqrt(0.04 + 1.0)) );
+
+	// Down-weighting the second key component changes the nearest entry
+	BOOST_REQUIRE( database.setKeyScaling(makeKey(1.0, 0.1)) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( database.getNearest(makeKey(0.8, 2.5), iterate) == SUCCESSFUL_RETURN );
+	requireEqual(iterate.x, makeIterate( 1.0 ).x);
+	BOOST_REQUIRE( database.setKeyScaling(DVector( )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( database.getNearest(makeKey(0.8, 2.5), iterate) == SUCCESSFUL_RETURN );
+	requireEqual(iterate.x, makeIterate( 2.0 ).x);
+
+	// An entry with the same key is replaced
+	BOOST_REQUIRE( database.add(makeKey(1.0, 0.0), makeIterate( 5.0 )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE_EQUAL(database.getNumEntries(), 3u);
+	BOOST_REQUIRE( database.getNearest(makeKey(1.0, 0.0), iterate, &distance) == SUCCESSFUL_RETURN );
+	requireEqual(iterate.x, makeIterate( 5.0 ).x);
+	BOOST_REQUIRE( acadoIsEqual(distance, 0.0) );
+}
+
+BOOST_AUTO_TEST_CASE( write_read_round_trip )
+{
+	const char* const fileName = "warm_start_database_unittest.txt";
+
+	WarmStartDatabase database;
+	for (unsigned k = 0; k < 4; ++k)
+		BOOST_REQUIRE( database.add(makeKey(0.5 * k, 1.0 - k), makeIterate( 3.0 * k )) == SUCCESSFUL_RETURN );
+	database.add(makeKey(7.0, 7.0), OCPiterate( ));
+
+	BOOST_REQUIRE( database.write( fileName ) == SUCCESSFUL_RETURN );
+
+	WarmStartDatabase copy;
+	BOOST_REQUIRE( copy.add(makeKey(100.0, 100.0), makeIterate( 42.0 )) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( copy.read( fileName ) == SUCCESSFUL_RETURN );
+	remove( fileName );
+
+	BOOST_REQUIRE_EQUAL(copy.getNumEntries(), database.getNumEntries());
+	BOOST_REQUIRE_EQUAL(copy.getKeyDim(), database.getKeyDim());
+
+	const double queries[][ 2 ] = {
+		{0.0, 1.0}, {0.6, -0.2}, {1.4, -2.1}, {2.0, -5.0}, {6.0, 8.0}, {100.0, 100.0}
+	};
+
+	for (unsigned k = 0; k < sizeof( queries ) / sizeof( queries[ 0 ] ); ++k)
+	{
+		OCPiterate a, b;
+		double da, db;
+
+		BOOST_REQUIRE( database.getNearest(makeKey(queries[ k ][ 0 ], queries[ k ][ 1 ]), a, &da) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( copy.getNearest(makeKey(queries[ k ][ 0 ], queries[ k ][ 1 ]), b, &db) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( acadoIsEqual(da, db) );
+
+		requireEqual(a.x, b.x);
+		requireEqual(a.xa, b.xa);
+		requireEqual(a.u, b.u);
+		requireEqual(a.w, b.w);
+
+		// grids without values are read back as missing ones
+		if (a.p != 0 && a.p->getNumValues() > 0)
+			requireEqual(a.p, b.p);
+		else
+			BOOST_REQUIRE( b.p == 0 );
+	}
+}